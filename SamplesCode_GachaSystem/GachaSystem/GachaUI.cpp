@@ -9,11 +9,18 @@
 
 #include "GachaUI.h"
 #include "InputTriggers.h"
+#include "Algo/BinarySearch.h"
+#include "Engine/AssetManager.h"
+#include "RewardDataSnapshot.h"
+#include "DataTable/GachaCampaignData.h"
+#include "DataTable/ItemDataTable.h"
 #include "DataTable/PlayerCharacterData.h"
 #include "DataTable/RewardData.h"
 #include "DataTable/VideoResourceData.h"
 #include "Network/UserData_Currency.h"
 #include "Network/UserData_Inventory.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
 #include "Subsystems/RewardManager.h"
 #include "Subsystems/VideoPlayer.h"
 #include "Subsystems/NetworkManager/NetworkManager.h"
@@ -28,40 +35,201 @@ void UGachaUI::Register()
 
 	// 모든 비디오 재생 완료 시 콜백 등록
 	UVideoPlayer::Get()->OnAllVideosEnd.AddUniqueDynamic(this, &ThisClass::OnEvent_VideoEnded);
+
+	// 연출 계획 : 스냅샷 교체 시 재구성, 재등록 시에는 버전이 바뀐 경우만
+	FRewardDataSnapshot::OnPublished().AddUObject(this, &ThisClass::BuildPresentationPlans);
+	{
+		const FRewardSnapshotPin Snapshot;
+		if (Snapshot->GetVersion() != PresentationSnapshotVersion)
+		{
+			BuildPresentationPlans();
+		}
+	}
+}
+
+namespace GachaUI
+{
+	/**
+	 * 캠페인 행 데이터 해시 (리플렉션 직렬화 CRC)
+	 */
+	uint32 HashCampaignData(const FGachaCampaignData& InData, TArray<uint8>& OutBuffer)
+	{
+		OutBuffer.Reset();
+		FMemoryWriter Writer(OutBuffer);
+		FObjectAndNameAsStringProxyArchive Archive(Writer, false);
+		FGachaCampaignData::StaticStruct()->SerializeBin(Archive, const_cast<FGachaCampaignData*>(&InData));
+		return FCrc::MemCrc32(OutBuffer.GetData(), OutBuffer.Num());
+	}
+
+	/**
+	 * 재생용 영상 데이터 복사본 생성
+	 */
+	FVideoResourceData MakeVideoResource(const FVideoResourceData& InData, const FString& InRootPath, const FName& InVideoName = NAME_None)
+	{
+		FVideoResourceData Result(InData);
+		Result.RootPath = InRootPath;
+		Result.VideoName = InVideoName;
+		return Result;
+	}
+
+	int32 GetDisplayOrder(const UGachaViewModel* InViewModel)
+	{
+		return InViewModel->ViewData.DisplayOrder;
+	}
+
+	/**
+	 * 구조체/객체의 소프트 참조 필드 수집 (리플렉션)
+	 * - TSoftObjectPtr / TSoftClassPtr 및 그 배열
+	 */
+	void CollectSoftObjectPaths(const UStruct* InStruct, const void* InContainer, TArray<FSoftObjectPath>& OutPaths)
+	{
+		if (!InStruct || !InContainer)
+		{
+			return;
+		}
+
+		for (TFieldIterator<FProperty> It(InStruct); It; ++It)
+		{
+			if (const FSoftObjectProperty* SoftProperty = CastField<FSoftObjectProperty>(*It))
+			{
+				const FSoftObjectPath& Path = SoftProperty->GetPropertyValue_InContainer(InContainer).ToSoftObjectPath();
+				if (Path.IsValid())
+				{
+					OutPaths.AddUnique(Path);
+				}
+			}
+			else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(*It))
+			{
+				const FSoftObjectProperty* InnerProperty = CastField<FSoftObjectProperty>(ArrayProperty->Inner);
+				if (!InnerProperty)
+				{
+					continue;
+				}
+
+				FScriptArrayHelper ArrayHelper(ArrayProperty, ArrayProperty->ContainerPtrToValuePtr<void>(InContainer));
+				for (int32 Index = 0; Index < ArrayHelper.Num(); ++Index)
+				{
+					const FSoftObjectPath& Path = InnerProperty->GetPropertyValue(ArrayHelper.GetRawPtr(Index)).ToSoftObjectPath();
+					if (Path.IsValid())
+					{
+						OutPaths.AddUnique(Path);
+					}
+				}
+			}
+		}
+	}
 }
 
 /**
- * 가챠 캠페인 데이터를 ViewModel로 변환
+ * 가챠 캠페인 데이터를 ViewModel로 변환 (증분)
  *
  * 로직:
  * 1. DataTable의 모든 가챠 캠페인을 순회
- * 2. 각 캠페인을 ViewModel로 변환 (캐싱 활용)
- * 3. DisplayOrder 기준으로 정렬
- * 4. UI 업데이트
+ * 2. 행 데이터 해시가 바뀐 캠페인만 ViewModel 재초기화 (캐싱 활용)
+ * 3. DisplayOrder 정렬 상태를 삽입/이동으로 유지
+ * 4. 사라진 캠페인 제거
+ * 5. 최초에는 전체(UpdateData), 이후에는 변경분만(UpdateDataDelta) 전달 (화면 재등록 포함)
  */
 void UGachaUI::BuildItems()
 {
-	TArray<UGachaViewModel*> ViewModels;
+	TArray<UGachaViewModel*> ChangedViewModels;
+	TArray<UGachaViewModel*> RemovedViewModels;
+	TSet<FName> VisitedRows;
+	VisitedRows.Reserve(CampaignDataHashes.Num());
+	bool bOrderChanged = false;
+
+	auto InsertSorted = [this](UGachaViewModel* InViewModel)
+	{
+		const int32 InsertIndex = Algo::UpperBoundBy(SortedViewModels, GachaUI::GetDisplayOrder(InViewModel), &GachaUI::GetDisplayOrder);
+		SortedViewModels.Insert(InViewModel, InsertIndex);
+	};
+
+	// 현재 판매 중인 캠페인만 (배너 일정 인덱스)
+	const FRewardSnapshotPin Snapshot;
+	TArray<const FCompiledGachaCampaign*> ActiveCampaigns;
+	Snapshot->GetSchedule().GetActiveCampaigns(FDateTime::UtcNow(), ActiveCampaigns);
 
-	// DataTable Visitor 패턴 사용
-	UGachaCampaignDataTable::Visit([this, &ViewModels](const FGachaCampaignData* GachaData)
+	for (const FCompiledGachaCampaign* Campaign : ActiveCampaigns)
 	{
-		const FName& RowName = GachaData->DataRowName;
-		if (UGachaViewModel* ViewModel{ FindOrAddViewModel(RowName) })
+		// 표시 데이터는 캠페인 테이블 행 (스냅샷은 판매 기간/피티 설정만 보관)
+		const FName& RowName = Campaign->RowName;
+		const FGachaCampaignData* GachaData = UGachaCampaignDataTable::FindRow(RowName);
+		if (!GachaData)
 		{
-			ViewModel->InitializeFromData(*GachaData);
-			ViewModels.Emplace(ViewModel);
+			// 로그 : [GachaUI] Campaign row not found: %s
+			continue;
 		}
-	});
+		VisitedRows.Add(RowName);
+
+		// 변경 없는 캠페인은 건너뜀
+		const uint32 DataHash = GachaUI::HashCampaignData(*GachaData, CampaignHashBuffer);
+		const uint32* PrevHash = CampaignDataHashes.Find(RowName);
+		if (PrevHash && *PrevHash == DataHash)
+		{
+			continue;
+		}
+
+		UGachaViewModel* ViewModel{ FindOrAddViewModel(RowName) };
+		if (!ViewModel)
+		{
+			continue;
+		}
+
+		const bool bIsNew = PrevHash == nullptr;
+		const int32 PrevDisplayOrder = ViewModel->ViewData.DisplayOrder;
 
-	// UI 표시 순서 정렬
-	ViewModels.Sort([](const UGachaViewModel& A, const UGachaViewModel& B)
+		ViewModel->InitializeFromData(*GachaData);
+		CampaignDataHashes.Add(RowName, DataHash);
+		ChangedViewModels.Emplace(ViewModel);
+
+		// UI 표시 순서 유지
+		if (bIsNew)
+		{
+			InsertSorted(ViewModel);
+			bOrderChanged = true;
+		}
+		else if (PrevDisplayOrder != ViewModel->ViewData.DisplayOrder)
+		{
+			SortedViewModels.RemoveSingle(ViewModel);
+			InsertSorted(ViewModel);
+			bOrderChanged = true;
+		}
+	}
+
+	// 테이블에서 사라졌거나 판매 종료된 캠페인 제거
+	if (VisitedRows.Num() != CampaignDataHashes.Num())
 	{
-		return A.ViewData.DisplayOrder < B.ViewData.DisplayOrder;
-	});
+		for (auto It = CampaignDataHashes.CreateIterator(); It; ++It)
+		{
+			if (VisitedRows.Contains(It.Key()))
+			{
+				continue;
+			}
+
+			TObjectPtr<UGachaViewModel> ViewModel;
+			if (CachedViewModels.RemoveAndCopyValue(It.Key(), ViewModel) && ViewModel)
+			{
+				SortedViewModels.RemoveSingle(ViewModel);
+				RemovedViewModels.Emplace(ViewModel);
+			}
+
+			It.RemoveCurrent();
+			bOrderChanged = true;
+		}
+	}
 
 	// Blueprint에 데이터 전달
-	UpdateData(ViewModels);
+	if (!bItemsBuilt)
+	{
+		bItemsBuilt = true;
+		UpdateData(SortedViewModels);
+		return;
+	}
+
+	if (!ChangedViewModels.IsEmpty() || !RemovedViewModels.IsEmpty())
+	{
+		UpdateDataDelta(ChangedViewModels, RemovedViewModels, bOrderChanged);
+	}
 }
 
 /**
@@ -166,6 +334,7 @@ void UGachaUI::OnExchangeTicket(const int32 InAmount)
  * - 동적으로 비디오 재생 순서 구성
  * - 고등급 결과에 따른 특수 연출 추가
  * - 캐릭터별 인트로 비디오 자동 삽입
+ * - 보상 행별 연출 계획에 준비된 영상 데이터를 수집만 수행 (행 조회, 문자열 생성 없음)
  *
  * @param InHandlers 가챠로 획득한 보상 목록
  * @param bGradeHigh 고등급 연출 사용 여부 (5성 이상)
@@ -177,72 +346,229 @@ void UGachaUI::SetVideosToPlay(const TArray<FRewardHandler>& InHandlers, const b
 		return;
 	}
 
-	UVideoResourceDataTable* VideoDataTable = UVideoResourceDataTable::Get();
-	if (!VideoDataTable)
+	// 보상당 최대 3개 (5성 연출, 캐릭터 인트로, 결과) + 인트로
+	TArray<FVideoResourceData> VideoResources;
+	VideoResources.Reserve(1 + InHandlers.Num() * 3);
+
+	// 1. 인트로 영상 (일반 또는 고등급용)
+	if (const TOptional<FVideoResourceData>& IntroVideo = bGradeHigh ? IntroSpecialVideo : IntroNormalVideo; IntroVideo.IsSet())
 	{
-		return;
+		VideoResources.Emplace(IntroVideo.GetValue());
 	}
 
-	TArray<FVideoResourceData> VideoResources;
+	// 인트로 재생 동안 결과 화면 에셋 로드 시작
+	PreloadResultAssets(InHandlers);
 
-	// 비디오 리소스 추가 헬퍼 람다
-	auto AddVideoResource = [&](const FName& InRowName, const FName& VideoName = NAME_None)
+	// 2. 결과 비디오 시퀀스 구성
+	for (const FRewardHandler& Handler : InHandlers)
 	{
-		if (const FVideoResourceData* ResultData = VideoDataTable->FindRow(InRowName))
+		const FGachaPresentationPlan& Plan = FindOrAddPresentationPlan(Handler.TypeRowName);
+		if (!Plan.bValid)
 		{
-			FVideoResourceData ResultDataCopy = *ResultData;
-			ResultDataCopy.RootPath = FileDir;
-			ResultDataCopy.VideoName = VideoName;
-			VideoResources.Emplace(MoveTemp(ResultDataCopy));
+			continue;
+		}
 
-			// 로그 : [GachaUI] Added Video: %s (VideoName=%s)
-			return true;
+		// 5성(전설 등급) 특수 연출
+		if (Plan.bSpecialGrade && SpecialGradeVideo.IsSet())
+		{
+			VideoResources.Emplace(SpecialGradeVideo.GetValue());
 		}
-		return false;
-	};
 
-	// 1. 인트로 영상 (일반 또는 고등급용)
-	const FName IntroName = bGradeHigh ? IntroSpecial : IntroNormal;
-	AddVideoResource(IntroName);
+		// 캐릭터 인트로 → 결과 표시 영상
+		VideoResources.Append(Plan.Videos.GetData(), Plan.Videos.Num());
+	}
+
+	// Blueprint에 비디오 재생 요청
+	OnPlayVideos(VideoResources);
+}
+
+/**
+ * 연출 계획 캐시 구성
+ *
+ * - 데이터 테이블 재로드 시 스냅샷도 재구성되므로 스냅샷 교체 시점에 한 번 구성
+ * - 보상 테이블의 모든 가챠 보상 행을 미리 구성 (뽑기 시점에는 수집만)
+ */
+void UGachaUI::BuildPresentationPlans()
+{
+	PresentationPlans.Reset();
+	IntroSpecialVideo.Reset();
+	IntroNormalVideo.Reset();
+	SpecialGradeVideo.Reset();
 
-	// 2. 결과 비디오 시퀀스 구성
-	for (const FRewardHandler& Handler : InHandlers)
 	{
-		const URewardGachaRandomData* GachaData = URewardGachaRandomDataTable::FindRow(Handler.TypeRowName);
-		if (!GachaData)
+		const FRewardSnapshotPin Snapshot;
+		PresentationSnapshotVersion = Snapshot->GetVersion();
+	}
+
+	UVideoResourceDataTable* VideoDataTable = UVideoResourceDataTable::Get();
+	if (!VideoDataTable)
+	{
+		return;
+	}
+
+	// 공통 연출 영상
+	auto PrepareVideo = [&](const FName& InRowName, TOptional<FVideoResourceData>& OutVideo)
+	{
+		if (const FVideoResourceData* ResourceData = InRowName.IsNone() ? nullptr : VideoDataTable->FindRow(InRowName))
 		{
-			continue;
+			OutVideo.Emplace(GachaUI::MakeVideoResource(*ResourceData, FileDir));
 		}
+	};
+	PrepareVideo(IntroSpecial, IntroSpecialVideo);
+	PrepareVideo(IntroNormal, IntroNormalVideo);
+	PrepareVideo(Video_5Star, SpecialGradeVideo);
 
-		// 캐릭터 보상인 경우
-		if (GachaData->Reward.RewardType == EReward::PlayerCharacter)
+	// 가챠 결과로 나올 수 있는 모든 보상 행
+	URewardDataTable::Visit([this](const URewardData* Data)
+	{
+		for (const TObjectPtr<URewardGachaRandomData>& GachaRandom : Data->GachaRandoms)
 		{
-			FName CharRowName = GachaData->Reward.TypeRowName;
-			if (const FPlayerCharacterData* PlayerCharacterData = UPlayerCharacterDataTable::FindRow(CharRowName))
+			if (GachaRandom)
 			{
-				// 5성(전설 등급) 특수 연출
-				static constexpr int32 SpecialGrade = 5;
-				if (PlayerCharacterData->Grade >= SpecialGrade)
-				{
-					AddVideoResource(Video_5Star);
-				}
+				FindOrAddPresentationPlan(GachaRandom->Reward.TypeRowName);
+			}
+		}
+	});
+
+	// 로그 : [GachaUI] Presentation plans built: %d (snapshot version %llu)
+}
 
-				// 캐릭터 인트로 영상
-				const FName CharIntroName(*(CharRowName.ToString() + IntroPrefix));
-				AddVideoResource(CharIntroName);
+/**
+ * 보상 행 연출 계획 구성
+ *
+ * 보상 행당 1회만 (스냅샷 교체 시 일괄 구성, 누락 행은 최초 조회 시):
+ * - 가챠 보상 / 캐릭터 / 영상 행 조회
+ * - 캐릭터 인트로 행 이름 생성 (CharRowName + IntroPrefix)
+ * - 재생할 영상 데이터 복사본 준비
+ */
+const FGachaPresentationPlan& UGachaUI::FindOrAddPresentationPlan(const FName& InRewardRowName)
+{
+	if (const FGachaPresentationPlan* CachedPlan = PresentationPlans.Find(InRewardRowName))
+	{
+		return *CachedPlan;
+	}
+
+	FGachaPresentationPlan& Plan = PresentationPlans.Add(InRewardRowName);
+
+	UVideoResourceDataTable* VideoDataTable = UVideoResourceDataTable::Get();
+	const URewardGachaRandomData* GachaData = URewardGachaRandomDataTable::FindRow(InRewardRowName);
+	if (!VideoDataTable || !GachaData)
+	{
+		return Plan;
+	}
+
+	Plan.bValid = true;
+
+	const FVideoResourceData* ResultVideo = VideoDataTable->FindRow(InRewardRowName);
+
+	// 결과 화면 에셋 : 가챠 보상 데이터 자체의 소프트 참조
+	GachaUI::CollectSoftObjectPaths(GachaData->GetClass(), GachaData, Plan.ResultAssets);
+
+	// 캐릭터 보상인 경우
+	if (GachaData->Reward.RewardType == EReward::PlayerCharacter)
+	{
+		const FName CharRowName = GachaData->Reward.TypeRowName;
+		if (const FPlayerCharacterData* PlayerCharacterData = UPlayerCharacterDataTable::FindRow(CharRowName))
+		{
+			static constexpr int32 SpecialGrade = 5;
+			Plan.bSpecialGrade = PlayerCharacterData->Grade >= SpecialGrade;
+
+			const FName CharIntroName(*(CharRowName.ToString() + IntroPrefix.ToString()));
+			if (const FVideoResourceData* CharIntroVideo = VideoDataTable->FindRow(CharIntroName))
+			{
+				Plan.Videos.Emplace(GachaUI::MakeVideoResource(*CharIntroVideo, FileDir));
 			}
+
+			// 캐릭터 초상화 등
+			GachaUI::CollectSoftObjectPaths(FPlayerCharacterData::StaticStruct(), PlayerCharacterData, Plan.ResultAssets);
+		}
+	}
+	// 아이템 보상인 경우
+	else if (GachaData->Reward.RewardType == EReward::Item)
+	{
+		if (const FItemBaseData* ItemData = UItemDataTable::FindRow<FItemBaseData>(GachaData->Reward.TypeRowName))
+		{
+			// 아이템 아이콘 등
+			GachaUI::CollectSoftObjectPaths(FItemBaseData::StaticStruct(), ItemData, Plan.ResultAssets);
 		}
+	}
 
-		// 결과 표시 영상
-		AddVideoResource(Handler.TypeRowName, Handler.TypeRowName);
+	// 결과 표시 영상 (캐릭터 인트로 다음) 및 소프트 참조 (결과 미디어 등)
+	if (ResultVideo)
+	{
+		Plan.Videos.Emplace(GachaUI::MakeVideoResource(*ResultVideo, FileDir, InRewardRowName));
+		GachaUI::CollectSoftObjectPaths(FVideoResourceData::StaticStruct(), ResultVideo, Plan.ResultAssets);
 	}
 
-	// Blueprint에 비디오 재생 요청
-	OnPlayVideos(VideoResources);
+	return Plan;
+}
+
+/**
+ * 결과 화면 에셋 비동기 로드
+ *
+ * 로직:
+ * 1. 보상별 연출 계획에 캐싱된 소프트 참조 수집
+ * 2. 인트로 영상이 재생되는 동안 높은 우선순위로 비동기 로드
+ * 3. 핸들을 유지하여 결과 화면이 닫힐 때까지 언로드 방지
+ */
+void UGachaUI::PreloadResultAssets(const TArray<FRewardHandler>& InHandlers)
+{
+	ReleaseResultAssets();
+
+	TArray<FSoftObjectPath> AssetPaths;
+	for (const FRewardHandler& Handler : InHandlers)
+	{
+		const FGachaPresentationPlan& Plan = FindOrAddPresentationPlan(Handler.TypeRowName);
+		for (const FSoftObjectPath& Path : Plan.ResultAssets)
+		{
+			AssetPaths.AddUnique(Path);
+		}
+	}
+
+	if (AssetPaths.IsEmpty())
+	{
+		return;
+	}
+
+	// 로그 : [GachaUI] Preload result assets (%d)
+	ResultAssetsHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		MoveTemp(AssetPaths),
+		FStreamableDelegate::CreateUObject(this, &ThisClass::OnResultAssetsLoaded),
+		FStreamableManager::AsyncLoadHighPriority);
+}
+
+void UGachaUI::ReleaseResultAssets()
+{
+	if (ResultAssetsHandle.IsValid())
+	{
+		ResultAssetsHandle->ReleaseHandle();
+		ResultAssetsHandle.Reset();
+	}
+
+	bPendingVideoEnded = false;
+}
+
+void UGachaUI::OnResultAssetsLoaded()
+{
+	// 로그 : [GachaUI] Result assets loaded
+
+	// 영상이 먼저 끝나 대기 중이었다면 이제 결과 표시
+	if (bPendingVideoEnded)
+	{
+		bPendingVideoEnded = false;
+		OnVideoEnded();
+	}
 }
 
 void UGachaUI::OnEvent_VideoEnded()
 {
+	// 결과 화면 에셋이 아직 로딩 중이면 완료 후 표시 (로딩 히치 방지)
+	if (ResultAssetsHandle.IsValid() && ResultAssetsHandle->IsLoadingInProgress())
+	{
+		bPendingVideoEnded = true;
+		return;
+	}
+
 	OnVideoEnded();
 }
 
@@ -254,5 +580,7 @@ void UGachaUI::Unregister()
 	UnBindUIInputMode();	
 
 	GachaRewards.Reset();
+	ReleaseResultAssets();
 	UVideoPlayer::Get()->OnAllVideosEnd.RemoveAll(this);
+	FRewardDataSnapshot::OnPublished().RemoveAll(this);
 }
@@ -12,14 +12,37 @@
 
 #include "CoreMinimal.h"
 #include "UI/UIScreen.h"
+#include "UObject/SoftObjectPath.h"
+#include "DataTable/VideoResourceData.h"
 #include "GachaUI.generated.h"
 
 struct FInputActionValue;
+struct FStreamableHandle;
 struct FVideoPlayHandler;
-struct FVideoResourceData;
 class UFileMediaSource;
 class UGachaViewModel;
 
+/**
+ * 가챠 보상 행별 연출 계획
+ * 보상 행 → 캐릭터/등급/영상 행 조회 결과를 캐싱하여
+ * 연출 시퀀스 구성 시 행 조회, 문자열 생성 없이 수집만 수행
+ * (영상 데이터는 복사본으로 보관, 테이블 재로드 후에도 유효)
+ */
+struct FGachaPresentationPlan
+{
+	// 가챠 보상 데이터 존재 여부 (false면 연출 없음)
+	bool bValid{ false };
+
+	// 5성 연출 포함 여부
+	bool bSpecialGrade{ false };
+
+	// 재생 영상 (캐릭터 인트로 → 결과, RootPath/VideoName 적용 완료)
+	TArray<FVideoResourceData, TInlineAllocator<2>> Videos;
+
+	// 결과 화면 에셋 (초상화, 아이콘, 결과 미디어 등 소프트 참조)
+	TArray<FSoftObjectPath> ResultAssets;
+};
+
 /**
  * 가챠 시스템의 메인 UI 스크린 클래스
  *
@@ -78,10 +101,39 @@ private:
 	UPROPERTY(Transient)
 	TMap<FName, TObjectPtr<UGachaViewModel>> CachedViewModels;
 
+	// DisplayOrder 정렬 상태 (CachedViewModels가 소유)
+	TArray<UGachaViewModel*> SortedViewModels;
+
+	// 캠페인 행별 데이터 해시 (변경 감지, 화면 해제 후에도 유지)
+	TMap<FName, uint32> CampaignDataHashes;
+
+	// 해시 계산용 직렬화 버퍼 (재사용)
+	TArray<uint8> CampaignHashBuffer;
+
+	// 전체 UpdateData 전달 여부
+	bool bItemsBuilt{ false };
+
+	// 결과 화면 에셋 비동기 로드 핸들 (다음 뽑기/화면 해제 시까지 유지)
+	TSharedPtr<FStreamableHandle> ResultAssetsHandle;
+
+	// 에셋 로드 완료 전에 영상이 끝나 결과 표시를 대기 중
+	bool bPendingVideoEnded{ false };
+
 	// 가챠 결과 보상 목록
 	UPROPERTY(Transient)
 	TArray<FRewardHandler> GachaRewards;
 
+	// 보상 행별 연출 계획 캐시
+	TMap<FName, FGachaPresentationPlan> PresentationPlans;
+
+	// 공통 연출 영상 (RootPath 적용 완료, 행이 없으면 미설정)
+	TOptional<FVideoResourceData> IntroSpecialVideo;
+	TOptional<FVideoResourceData> IntroNormalVideo;
+	TOptional<FVideoResourceData> SpecialGradeVideo;
+
+	// 연출 계획을 구성한 스냅샷 버전 (화면 재등록 시 같으면 재사용)
+	uint64 PresentationSnapshotVersion{ 0 };
+
 protected:
 	// 생명주기 관리
 	virtual void Register() override;
@@ -100,6 +152,21 @@ protected:
 	UFUNCTION(BlueprintImplementableEvent, BlueprintCallable, Category="UI Update")
 	void UpdateData(const TArray<UGachaViewModel*>& InData);
 
+	/**
+	 * Blueprint에서 구현: 변경분만 받아 UI 업데이트 (최초 이후 BuildItems)
+	 * @param InChanged 추가되었거나 데이터가 바뀐 ViewModel
+	 * @param InRemoved 테이블에서 사라진 ViewModel
+	 * @param bOrderChanged 표시 순서 변경 여부 (true면 GetSortedViewModels 순서로 재배치)
+	 */
+	UFUNCTION(BlueprintImplementableEvent, Category="UI Update")
+	void UpdateDataDelta(const TArray<UGachaViewModel*>& InChanged, const TArray<UGachaViewModel*>& InRemoved, const bool bOrderChanged);
+
+	/**
+	 * DisplayOrder 순으로 정렬된 ViewModel 목록
+	 */
+	UFUNCTION(BlueprintPure, Category="UI Update")
+	TArray<UGachaViewModel*> GetSortedViewModels() const { return SortedViewModels; }
+
 	// Enhanced Input System 통합
 	virtual TArray<FWidgetInputHandler> GenerateInputs() const override;
 
@@ -174,4 +241,23 @@ private:
 	// 비디오 재생 완료 콜백
 	UFUNCTION()
 	void OnEvent_VideoEnded();
+
+	/**
+	 * 모든 가챠 보상 행의 연출 계획 구성
+	 * 화면 등록(Register) 시 버전이 바뀌었거나 스냅샷 교체(OnPublished) 시 호출
+	 */
+	void BuildPresentationPlans();
+
+	/**
+	 * 보상 행의 연출 계획 조회 (없으면 구성)
+	 */
+	const FGachaPresentationPlan& FindOrAddPresentationPlan(const FName& InRewardRowName);
+
+	/**
+	 * 인트로 영상 재생 중 결과 화면 에셋 비동기 로드
+	 * OpenGachaResult 시점에 로딩 히치가 없도록 미리 준비
+	 */
+	void PreloadResultAssets(const TArray<FRewardHandler>& InHandlers);
+	void ReleaseResultAssets();
+	void OnResultAssetsLoaded();
 };
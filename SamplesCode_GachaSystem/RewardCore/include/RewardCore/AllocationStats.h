@@ -0,0 +1,76 @@
+/**
+ * RewardCore - Allocation Stats
+ *
+ * 서브시스템 태그별 할당 카운터 (횟수, 누적 바이트, 현재/최대 바이트)
+ * - 태그는 스레드별 현재 값 (FAllocTagScope로 지정)
+ * - 집계는 할당 훅이 RecordAlloc/RecordFree로 전달 (도구는 AllocationHooks.cpp의 operator new)
+ * - UE 빌드는 같은 태그 이름의 LLM 태그 사용 (RewardSystem/RewardAllocTags.h)
+ */
+
+#pragma once
+
+#include "RewardCore/RewardTypes.h"
+#include <cstddef>
+
+namespace RewardCore
+{
+	enum class EAllocTag : uint8
+	{
+		Untagged,
+		Reward,		// 가챠 추첨, 보상팩 전개
+		Inventory,	// 아이템 병합, 슬롯 시뮬레이션, 지급
+		Video,
+		Subtitle,
+		Num
+	};
+
+	struct FAllocStats
+	{
+		uint64 Count = 0;
+		uint64 TotalBytes = 0;
+		int64 LiveBytes = 0;
+		int64 PeakBytes = 0;
+	};
+
+	/**
+	 * 현재 스레드 할당 태그 지정 (소멸 시 이전 태그 복원)
+	 */
+	class FAllocTagScope
+	{
+	public:
+		explicit FAllocTagScope(const EAllocTag InTag);
+		~FAllocTagScope();
+
+		FAllocTagScope(const FAllocTagScope&) = delete;
+		FAllocTagScope& operator=(const FAllocTagScope&) = delete;
+
+	private:
+		EAllocTag PrevTag;
+	};
+
+	EAllocTag GetAllocTag();
+
+	// 할당 훅 전용
+	void RecordAlloc(const EAllocTag InTag, const size_t InBytes);
+	void RecordFree(const EAllocTag InTag, const size_t InBytes);
+	void SetAllocTrackingActive();
+
+	/**
+	 * 훅이 연결되어 있지 않으면 모든 카운터 0
+	 */
+	bool IsAllocTrackingActive();
+
+	FAllocStats GetAllocStats(const EAllocTag InTag);
+
+	/**
+	 * 전체 태그 합계 (PeakBytes는 태그별 최대값의 합)
+	 */
+	FAllocStats GetTotalAllocStats();
+
+	/**
+	 * 최대 바이트를 현재 바이트로 초기화 (구간별 최대값 측정)
+	 */
+	void ResetAllocPeaks();
+
+	const char* GetAllocTagName(const EAllocTag InTag);
+}
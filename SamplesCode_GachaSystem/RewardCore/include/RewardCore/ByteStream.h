@@ -0,0 +1,105 @@
+/**
+ * RewardCore - Byte Stream
+ *
+ * 자명하게 복사 가능한 값의 바이트 직렬화 (리틀 엔디언 플랫폼 전제, 정렬 없음)
+ */
+
+#pragma once
+
+#include "RewardCore/RewardTypes.h"
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace RewardCore
+{
+	class FByteWriter
+	{
+	public:
+		explicit FByteWriter(std::vector<uint8>& InBuffer) : Buffer(InBuffer) {}
+
+		template <typename T>
+		void Write(const T& InValue)
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "FByteWriter::Write requires a trivially copyable type");
+			const size_t Offset = Buffer.size();
+			Buffer.resize(Offset + sizeof(T));
+			std::memcpy(Buffer.data() + Offset, &InValue, sizeof(T));
+		}
+
+		/**
+		 * 개수(uint32) + 원소
+		 */
+		template <typename T>
+		void WriteArray(const T* InValues, const size_t InNum)
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "FByteWriter::WriteArray requires a trivially copyable type");
+			Write(static_cast<uint32>(InNum));
+			if (InNum > 0)
+			{
+				const size_t Offset = Buffer.size();
+				Buffer.resize(Offset + sizeof(T) * InNum);
+				std::memcpy(Buffer.data() + Offset, InValues, sizeof(T) * InNum);
+			}
+		}
+
+		template <typename T, typename AllocatorType>
+		void WriteArray(const std::vector<T, AllocatorType>& InValues) { WriteArray(InValues.data(), InValues.size()); }
+
+		size_t Tell() const { return Buffer.size(); }
+		uint8* GetData(const size_t InOffset) { return Buffer.data() + InOffset; }
+
+	private:
+		std::vector<uint8>& Buffer;
+	};
+
+	class FByteReader
+	{
+	public:
+		FByteReader(const uint8* InData, const size_t InSize) : Data(InData), Size(InSize) {}
+
+		/**
+		 * 범위를 벗어나면 이후 모든 읽기 실패 (IsValid false)
+		 */
+		template <typename T>
+		bool Read(T& OutValue)
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "FByteReader::Read requires a trivially copyable type");
+			if (!bValid || Size - Offset < sizeof(T))
+			{
+				bValid = false;
+				return false;
+			}
+			std::memcpy(&OutValue, Data + Offset, sizeof(T));
+			Offset += sizeof(T);
+			return true;
+		}
+
+		template <typename T, typename AllocatorType>
+		bool ReadArray(std::vector<T, AllocatorType>& OutValues)
+		{
+			uint32 Num = 0;
+			if (!Read(Num) || (Size - Offset) / sizeof(T) < Num)
+			{
+				bValid = false;
+				return false;
+			}
+			OutValues.resize(Num);
+			if (Num > 0)
+			{
+				std::memcpy(OutValues.data(), Data + Offset, sizeof(T) * Num);
+				Offset += sizeof(T) * Num;
+			}
+			return true;
+		}
+
+		bool IsValid() const { return bValid; }
+		bool IsEnd() const { return Offset == Size; }
+
+	private:
+		const uint8* Data = nullptr;
+		size_t Size = 0;
+		size_t Offset = 0;
+		bool bValid = true;
+	};
+}
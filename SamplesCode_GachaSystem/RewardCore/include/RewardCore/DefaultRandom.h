@@ -0,0 +1,38 @@
+/**
+ * RewardCore - Default Random
+ *
+ * 결정적 난수 (벤치마크, 시뮬레이션, 트래픽 재현)
+ * xoshiro256** (시드는 splitmix64로 확장)
+ * 시드 + 생성 횟수(Counter)만으로 같은 수열 재현
+ */
+
+#pragma once
+
+#include "RewardCore/Interfaces.h"
+
+namespace RewardCore
+{
+	class FDefaultRandom final : public IRandom
+	{
+	public:
+		explicit FDefaultRandom(const uint64 InSeed = 0);
+
+		virtual int32 RandRange(const int32 InMin, const int32 InMax) override;
+
+		void Seed(const uint64 InSeed);
+		uint64 Next();
+
+		/**
+		 * InCount 회 건너뛰기 (재현 시 기록된 Counter 위치로 이동)
+		 */
+		void Discard(const uint64 InCount);
+
+		uint64 GetSeed() const { return SeedValue; }
+		uint64 GetCounter() const { return Counter; }
+
+	private:
+		uint64 State[4] = {};
+		uint64 SeedValue = 0;
+		uint64 Counter = 0;
+	};
+}
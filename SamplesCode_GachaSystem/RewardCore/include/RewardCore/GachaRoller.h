@@ -0,0 +1,39 @@
+/**
+ * RewardCore - Gacha Roller
+ *
+ * 피티 상태 머신 + 가중치 추첨을 묶은 가챠 N회 뽑기
+ */
+
+#pragma once
+
+#include "RewardCore/Interfaces.h"
+#include "RewardCore/PityStateMachine.h"
+#include "RewardCore/RewardArena.h"
+
+namespace RewardCore
+{
+	/**
+	 * 픽업 그룹 이상 후보 중 1개 균등 선택 (후보 없으면 빈 보상)
+	 */
+	FPackedReward PickupReward(const FWeightedSampler& InSampler, const int32 InPickupGroup, IRandom& InRandom);
+
+	/**
+	 * 가중치 추첨 1회 (후보 없으면 빈 보상, OutPickupGroup 0)
+	 */
+	FPackedReward RollReward(const FWeightedSampler& InSampler, const int32 InTotalWeight, IRandom& InRandom, int32& OutPickupGroup);
+
+	/**
+	 * 가챠 N회 뽑기
+	 * @param InOutState 피티 카운터 (뽑기 결과 반영)
+	 * @param OutRewards 결과 보상 (추가)
+	 * @return 가챠 보상이 없거나 횟수가 0 이하면 false (상태 변경 없음)
+	 */
+	bool PullGacha(const FRewardDefinition& InReward, const FPityConfig& InConfig, FPityState& InOutState, const int32 InPullCount, IRandom& InRandom, FPackedRewardArray& OutRewards);
+
+	/**
+	 * 가챠 N회 뽑기 (피티 저장소 사용)
+	 * 저장소에서 카운터를 읽어 뽑기 후 다시 저장
+	 * @return 요청한 횟수만큼 보상을 얻었으면 true
+	 */
+	bool PullGacha(const IRewardData& InData, IPityStore& InPityStore, IRandom& InRandom, const FRowId InRewardId, const FPityConfig& InConfig, const int32 InPullCount, FPackedRewardArray& OutRewards);
+}
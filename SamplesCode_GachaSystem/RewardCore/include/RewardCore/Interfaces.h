@@ -0,0 +1,73 @@
+/**
+ * RewardCore - Pluggable Interfaces
+ *
+ * 코어 로직이 외부(엔진/DB/테스트 하네스)에 의존하는 지점
+ * - IRandom : 난수 (UE는 FMath, 네이티브는 FDefaultRandom)
+ * - IRewardData : 컴파일된 보상/아이템 데이터 (UE는 FRewardDataSnapshot)
+ * - IPityStore : 피티 카운터 저장소 (UE는 UContentsAlarmSave)
+ * - IInventoryView : 계정 인벤토리 조회 (UE는 UUserData_Inventory)
+ * - IInventoryStore : 계정 인벤토리 변경 (도구의 SQLite 게임 DB 등, UE는 URewardManager 경유)
+ */
+
+#pragma once
+
+#include "RewardCore/RewardDefinition.h"
+
+namespace RewardCore
+{
+	struct FPityState;
+
+	class IRandom
+	{
+	public:
+		virtual ~IRandom() = default;
+
+		/**
+		 * [InMin, InMax] 범위 정수 (양 끝 포함, FMath::RandRange와 동일)
+		 */
+		virtual int32 RandRange(const int32 InMin, const int32 InMax) = 0;
+	};
+
+	class IRewardData
+	{
+	public:
+		virtual ~IRewardData() = default;
+
+		// 유효하지 않은 ID면 nullptr
+		virtual const FRewardDefinition* GetRewardDefinition(const FRowId InRewardId) const = 0;
+		virtual const FItemDefinition* GetItemDefinition(const FRowId InItemId) const = 0;
+		virtual int32 GetRewardDefinitionNum() const = 0;
+		virtual int32 GetItemDefinitionNum() const = 0;
+	};
+
+	class IPityStore
+	{
+	public:
+		virtual ~IPityStore() = default;
+
+		// 보상 묶음(가챠 그룹)별 피티 카운터
+		virtual void LoadPity(const FRowId InRewardId, FPityState& OutState) = 0;
+		virtual void SavePity(const FRowId InRewardId, const FPityState& InState) = 0;
+	};
+
+	class IInventoryView
+	{
+	public:
+		virtual ~IInventoryView() = default;
+
+		virtual int32 GetItemSlotCount() const = 0;
+		virtual int32 GetMaxCapacity() const = 0;
+		virtual int32 GetAmount(const FRowId InItemId) const = 0;
+	};
+
+	class IInventoryStore : public IInventoryView
+	{
+	public:
+		/**
+		 * 아이템 수량 변경 (음수면 제거, 보유 수량 이하로만)
+		 * 슬롯 수 갱신 규칙은 FSlotSimulator와 동일해야 함
+		 * @return 저장 실패 시 false (호출 측 트랜잭션 롤백)
+		 */
+		virtual bool ApplyItem(const FRowId InItemId, const FItemDefinition& InItem, const int32 InAmount) = 0;
+	};
+}
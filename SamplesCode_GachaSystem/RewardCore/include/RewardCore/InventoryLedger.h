@@ -0,0 +1,134 @@
+/**
+ * RewardCore - Inventory Reservation Ledger
+ *
+ * 계정별 인벤토리 예약 원장 (같은 계정 지급 트랜잭션 동시 실행용)
+ * - 시뮬레이션은 "반영된 인벤토리 + 진행 중 예약" 기준으로 슬롯 판정 후 원자적으로 예약
+ * - 예약 : 스택 불가 아이템 슬롯 + 스택 슬롯(스택 여유분), 트랜잭션 커밋/롤백 시 해제
+ * - 스택 가능 아이템은 반영 인벤토리에 없을 때만 스택 슬롯 예약 (보유 중이면 스택 여유분(수량)만)
+ *   예약된 스택 슬롯은 같은 아이템 예약이 모두 끝날 때까지 유지
+ * - 감소(소모)는 커밋 전까지 슬롯을 돌려주지 않음 (보수적 판정, 초과 지급 없음)
+ * - 계정 ID 기준 샤드 잠금 (다른 계정 트랜잭션은 경합 없음), 정상 상태에서 예약당 힙 할당 없음
+ *
+ * 사용 순서 (FLedgerView가 살아 있는 동안 계정 샤드 잠금):
+ *   FInventoryLedger::FLedgerView View(Ledger, AccountId, Inventory);
+ *   FSlotSimulator Slots(View); ... 판정 통과 시
+ *   const FReservationId Id = View.Reserve(Data, Merged.data(), Merged.size());
+ *   저장소 커밋 후 Ledger.Commit(Id) / 실패 시 Ledger.Release(Id)
+ *
+ * 주의 : 저장소 반영을 먼저 하고 예약 해제 (사이 구간은 이중 계산 → 안전한 쪽)
+ *        Inventory는 잠금 이후 시점의 최신 상태를 읽어야 함 (이전에 연 읽기 스냅샷 사용 금지)
+ */
+
+#pragma once
+
+#include "RewardCore/Interfaces.h"
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace RewardCore
+{
+	using FReservationId = uint64;
+	constexpr FReservationId InvalidReservationId = 0;
+
+	class FInventoryLedger
+	{
+	private:
+		struct FItemReservation
+		{
+			FRowId ItemId = InvalidRowId;
+			int32 Amount = 0;
+			int32 StackRefs = 0;	// 이 아이템을 추가하는 예약 수
+			bool bSlotReserved = false;	// 스택 슬롯 예약 여부 (반영 인벤토리에 없던 아이템)
+		};
+
+		/**
+		 * 계정별 예약 합계 (진행 중 아이템 수가 적으므로 배열 선형 탐색)
+		 * 예약이 끝나도 배열 용량 유지, 유휴 계정은 샤드당 MaxIdleAccounts 초과 시에만 제거
+		 */
+		struct FAccount
+		{
+			int32 NonStackableSlots = 0;
+			int32 StackSlots = 0;
+			int32 ReservationNum = 0;
+			std::vector<FItemReservation> Items;
+
+			int32 GetReservedSlots() const { return NonStackableSlots + StackSlots; }
+			const FItemReservation* FindItem(const FRowId InItemId) const;
+		};
+
+		struct FReservation
+		{
+			uint64 AccountId = 0;
+			uint32 Generation = 0;
+			bool bActive = false;
+			int32 NonStackableSlots = 0;
+			std::vector<FItemReservation> Items;
+		};
+
+		/**
+		 * 예약은 슬롯 재사용 (해제된 슬롯의 배열 용량 유지, 세대 번호로 중복 해제 방지)
+		 */
+		struct FShard
+		{
+			std::mutex Mutex;
+			std::unordered_map<uint64, FAccount> Accounts;
+			std::vector<FReservation> Reservations;
+			std::vector<uint32> FreeReservations;
+		};
+
+	public:
+		/**
+		 * 예약 반영 인벤토리 뷰 (생성 ~ 소멸 동안 계정 샤드 잠금)
+		 * 슬롯 수 = 반영 슬롯 + 예약 슬롯, 보유 수량 = 반영 수량 + 예약 수량
+		 */
+		class FLedgerView final : public IInventoryView
+		{
+		public:
+			FLedgerView(FInventoryLedger& InLedger, const uint64 InAccountId, const IInventoryView& InCommitted);
+
+			FLedgerView(const FLedgerView&) = delete;
+			FLedgerView& operator=(const FLedgerView&) = delete;
+
+			virtual int32 GetItemSlotCount() const override;
+			virtual int32 GetMaxCapacity() const override { return Committed.GetMaxCapacity(); }
+			virtual int32 GetAmount(const FRowId InItemId) const override;
+
+			/**
+			 * 보상 목록 예약 (FSlotSimulator::AddRewards와 같은 대상 : 행 ID 있는 아이템, 획득 경로 없음(0))
+			 * 판정은 호출 측에서 이 뷰로 먼저 수행
+			 * @return 예약할 슬롯/수량이 없으면 InvalidReservationId
+			 */
+			FReservationId Reserve(const IRewardData& InData, const FPackedReward* InRewards, const size_t InRewardNum);
+
+		private:
+			FShard& Shard;
+			std::lock_guard<std::mutex> Lock;
+			const uint64 AccountId;
+			const IInventoryView& Committed;
+			const FAccount* Account;
+		};
+
+		/**
+		 * 트랜잭션 커밋 후 예약 해제 (반영된 인벤토리가 대신 계산)
+		 */
+		void Commit(const FReservationId InReservationId) { Remove(InReservationId); }
+
+		/**
+		 * 트랜잭션 실패/롤백 시 예약 해제
+		 */
+		void Release(const FReservationId InReservationId) { Remove(InReservationId); }
+
+		int32 GetReservedSlots(const uint64 InAccountId);
+
+	private:
+		static constexpr int32 ShardBits = 6;
+		static constexpr int32 ShardNum = 1 << ShardBits;
+		static constexpr size_t MaxIdleAccounts = 256;
+
+		FShard& GetShard(const uint64 InAccountId) { return Shards[InAccountId % ShardNum]; }
+		void Remove(const FReservationId InReservationId);
+
+		FShard Shards[ShardNum];
+	};
+}
@@ -0,0 +1,43 @@
+/**
+ * RewardCore - Packed Reward
+ *
+ * 보상 지급 파이프라인 내부용 고정 크기 보상 레코드
+ * - 이름 대신 행/이름 ID 사용
+ * - 자명하게 복사 가능(trivially copyable) → 대량 보상 배열 memcpy, 캐시 밀도 향상
+ * - UE FRewardHandler 변환은 FRewardDataSnapshot::Pack / Unpack (외부 API 경계에서만)
+ */
+
+#pragma once
+
+#include "RewardCore/RewardTypes.h"
+#include <type_traits>
+
+namespace RewardCore
+{
+	struct FPackedReward
+	{
+		enum EFlags : uint8
+		{
+			// Id가 행 ID가 아닌 이름 ID (보상 묶음/아이템 외 보상, 또는 행 없는 이름)
+			NameOnly = 1 << 0,
+
+			// 보상 종류 (RewardType 원본 값과 무관하게 코어가 판단할 수 있도록 변환 시 기록)
+			Bundle = 1 << 1,	// EReward::RewardData : 재귀 전개 대상
+			Item = 1 << 2,		// EReward::Item : 인벤토리 슬롯 시뮬레이션 대상
+		};
+
+		uint32 Id = InvalidRowId;
+		int32 Amount = 0;
+		uint8 RewardType = 0;		// EReward 원본 값
+		uint8 AcquireSource = 0;	// ERewardSource 원본 값
+		uint8 Flags = NameOnly;
+		uint8 Padding = 0;
+
+		bool HasRowId() const { return !(Flags & NameOnly) && Id != InvalidRowId; }
+		bool IsBundle() const { return (Flags & Bundle) != 0; }
+		bool IsItem() const { return (Flags & Item) != 0; }
+	};
+
+	static_assert(sizeof(FPackedReward) <= 16, "FPackedReward must stay within 16 bytes");
+	static_assert(std::is_trivially_copyable_v<FPackedReward>, "FPackedReward must be trivially copyable");
+}
@@ -0,0 +1,66 @@
+/**
+ * RewardCore - Pity State Machine
+ *
+ * 가챠 천장(피티) 판정
+ * - 특별 천장 : SpecialTryCount 회 이내 특별 픽업 미획득 시 확정
+ * - 일반 천장 : NormalTryCount 회 이내 일반 픽업 미획득 시 확정
+ * - 일반 추첨에서 픽업 획득 시 해당 카운터 초기화
+ */
+
+#pragma once
+
+#include "RewardCore/RewardTypes.h"
+
+namespace RewardCore
+{
+	struct FPityConfig
+	{
+		// 0이면 해당 천장 비활성
+		int32 NormalPickupGroup = 0;
+		int32 SpecialPickupGroup = 0;
+
+		int32 SpecialTryCount = 0;
+		int32 NormalTryCount = 10;
+	};
+
+	struct FPityState
+	{
+		int32 NormalCounter = 0;
+		int32 SpecialCounter = 0;
+	};
+
+	enum class EPityAction : uint8
+	{
+		Roll,		// 일반 가중치 추첨
+		Normal,		// 일반 천장 (NormalPickupGroup 이상 후보 중 선택)
+		Special,	// 특별 천장 (SpecialPickupGroup 이상 후보 중 선택)
+	};
+
+	class FPityStateMachine
+	{
+	public:
+		FPityStateMachine(const FPityConfig& InConfig, const FPityState& InState);
+
+		/**
+		 * 1회 뽑기 시작 : 카운터 증가 후 천장 판정 (천장이면 해당 카운터 초기화)
+		 */
+		EPityAction BeginPull();
+
+		/**
+		 * 일반 추첨 결과 반영
+		 * @param InPickupGroup 추첨된 보상의 픽업 그룹
+		 */
+		void OnRolled(const int32 InPickupGroup);
+
+		/**
+		 * 천장 행동에 대응하는 최소 픽업 그룹
+		 */
+		int32 GetPickupGroup(const EPityAction InAction) const;
+
+		const FPityState& GetState() const { return State; }
+
+	private:
+		FPityConfig Config;
+		FPityState State;
+	};
+}
@@ -0,0 +1,137 @@
+/**
+ * RewardCore - Reward Arena
+ *
+ * 보상 트랜잭션 단위 선형 할당기
+ * - 블록에서 순서대로 잘라 쓰고 개별 해제 없음, 스코프 종료 시 한 번에 되감기 (블록은 유지해 재사용)
+ * - 스레드별 아레나 + FRewardArenaScope (UE FMemStack / FMemMark와 같은 사용 규칙)
+ *   1) 스코프 안에서 만든 컨테이너는 스코프 밖으로 내보내지 않음
+ *   2) 안쪽 스코프가 살아 있는 동안 바깥 스코프 컨테이너를 키우지 않음
+ * - 아레나 없이 만든 컨테이너(기본 생성 할당기)는 일반 힙 사용
+ */
+
+#pragma once
+
+#include "RewardCore/PackedReward.h"
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace RewardCore
+{
+	class FRewardArena
+	{
+	public:
+		struct FMark
+		{
+			size_t Block = 0;
+			size_t Offset = 0;
+		};
+
+		explicit FRewardArena(const size_t InBlockSize = 64 * 1024);
+		~FRewardArena();
+
+		FRewardArena(const FRewardArena&) = delete;
+		FRewardArena& operator=(const FRewardArena&) = delete;
+
+		void* Allocate(const size_t InSize, const size_t InAlignment);
+
+		FMark GetMark() const { return FMark{ Current, Offset }; }
+
+		/**
+		 * InMark 이후 할당 전부 해제 (블록은 유지)
+		 */
+		void Rewind(const FMark& InMark);
+		void Reset() { Rewind(FMark()); }
+
+		size_t GetUsedBytes() const;
+		size_t GetReservedBytes() const;
+
+		/**
+		 * 현재 스레드 아레나 (워커 스레드마다 1개, 트랜잭션 최대 사용량만큼 유지)
+		 */
+		static FRewardArena& GetThreadArena();
+
+	private:
+		struct FBlock
+		{
+			uint8* Data = nullptr;
+			size_t Size = 0;
+		};
+
+		std::vector<FBlock> Blocks;
+		size_t BlockSize;
+		size_t Current = 0;
+		size_t Offset = 0;
+	};
+
+	/**
+	 * 트랜잭션 스코프 (생성 시점 위치 기록, 소멸 시 되감기)
+	 */
+	class FRewardArenaScope
+	{
+	public:
+		FRewardArenaScope() : FRewardArenaScope(FRewardArena::GetThreadArena()) {}
+		explicit FRewardArenaScope(FRewardArena& InArena) : Arena(InArena), Mark(InArena.GetMark()) {}
+		~FRewardArenaScope() { Arena.Rewind(Mark); }
+
+		FRewardArenaScope(const FRewardArenaScope&) = delete;
+		FRewardArenaScope& operator=(const FRewardArenaScope&) = delete;
+
+		FRewardArena& GetArena() const { return Arena; }
+
+	private:
+		FRewardArena& Arena;
+		FRewardArena::FMark Mark;
+	};
+
+	/**
+	 * 표준 컨테이너용 할당기 (아레나 없으면 힙)
+	 */
+	template <typename T>
+	class TRewardArenaAllocator
+	{
+	public:
+		using value_type = T;
+		using propagate_on_container_move_assignment = std::true_type;
+		using propagate_on_container_swap = std::true_type;
+
+		TRewardArenaAllocator() noexcept = default;
+		TRewardArenaAllocator(FRewardArena& InArena) noexcept : Arena(&InArena) {}
+
+		template <typename U>
+		TRewardArenaAllocator(const TRewardArenaAllocator<U>& InOther) noexcept : Arena(InOther.GetArena()) {}
+
+		T* allocate(const size_t InNum)
+		{
+			return static_cast<T*>(Arena ? Arena->Allocate(InNum * sizeof(T), alignof(T)) : ::operator new(InNum * sizeof(T)));
+		}
+
+		void deallocate(T* InPointer, const size_t) noexcept
+		{
+			// 아레나 메모리는 스코프 종료 시 일괄 해제
+			if (!Arena)
+			{
+				::operator delete(InPointer);
+			}
+		}
+
+		FRewardArena* GetArena() const noexcept { return Arena; }
+
+	private:
+		FRewardArena* Arena = nullptr;
+	};
+
+	template <typename T, typename U>
+	bool operator==(const TRewardArenaAllocator<T>& InA, const TRewardArenaAllocator<U>& InB) noexcept { return InA.GetArena() == InB.GetArena(); }
+
+	template <typename T, typename U>
+	bool operator!=(const TRewardArenaAllocator<T>& InA, const TRewardArenaAllocator<U>& InB) noexcept { return InA.GetArena() != InB.GetArena(); }
+
+	template <typename T>
+	using TRewardArenaVector = std::vector<T, TRewardArenaAllocator<T>>;
+
+	/**
+	 * 코어 보상 출력 배열 (뽑기/전개/병합 결과)
+	 */
+	using FPackedRewardArray = TRewardArenaVector<FPackedReward>;
+}
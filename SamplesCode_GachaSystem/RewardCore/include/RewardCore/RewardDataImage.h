@@ -0,0 +1,35 @@
+/**
+ * RewardCore - Reward Data Image
+ *
+ * 컴파일된 보상/아이템 정의의 독립 사본 (직렬화 가능)
+ * - 트래픽 로그에 당시 데이터를 함께 기록해 엔진/데이터 테이블 없이 재현
+ * - 행 ID는 원본 IRewardData와 동일
+ */
+
+#pragma once
+
+#include "RewardCore/Interfaces.h"
+
+namespace RewardCore
+{
+	class FRewardDataImage final : public IRewardData
+	{
+	public:
+		/**
+		 * 원본 데이터 전체 복사
+		 */
+		void Capture(const IRewardData& InData);
+
+		void Serialize(std::vector<uint8>& OutBuffer) const;
+		bool Deserialize(const uint8* InData, const size_t InSize);
+
+		virtual const FRewardDefinition* GetRewardDefinition(const FRowId InRewardId) const override;
+		virtual const FItemDefinition* GetItemDefinition(const FRowId InItemId) const override;
+		virtual int32 GetRewardDefinitionNum() const override { return static_cast<int32>(Rewards.size()); }
+		virtual int32 GetItemDefinitionNum() const override { return static_cast<int32>(Items.size()); }
+
+	private:
+		std::vector<FRewardDefinition> Rewards;
+		std::vector<FItemDefinition> Items;
+	};
+}
@@ -0,0 +1,40 @@
+/**
+ * RewardCore - Reward / Item Definition
+ *
+ * 컴파일된 보상 묶음과 아이템 메타데이터 (데이터 소스와 무관한 형태)
+ */
+
+#pragma once
+
+#include "RewardCore/WeightedSampler.h"
+#include <vector>
+
+namespace RewardCore
+{
+	/**
+	 * 보상 묶음 (URewardData 대응)
+	 */
+	struct FRewardDefinition
+	{
+		// 고정 보상
+		std::vector<FPackedReward> Statics;
+
+		// 랜덤 보상 1개 (Randoms, TotalWeight)
+		FWeightedSampler Randoms;
+		int32 TotalWeight = 0;
+
+		// 가챠 보상 (GachaRandoms, TotalGachaWeight)
+		FWeightedSampler Gacha;
+		int32 TotalGachaWeight = 0;
+	};
+
+	/**
+	 * 아이템 메타데이터 (인벤토리 시뮬레이션용)
+	 */
+	struct FItemDefinition
+	{
+		int32 MaxStackAmount = 0;
+		bool bNonStackable = false;
+		bool bRequiresInventorySlot = false;
+	};
+}
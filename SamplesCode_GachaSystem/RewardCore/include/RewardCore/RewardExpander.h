@@ -0,0 +1,23 @@
+/**
+ * RewardCore - Reward Expander
+ *
+ * 보상 묶음(EReward::RewardData) 재귀 전개
+ * 고정 보상 전체 + 랜덤 보상 1개, 하위 묶음은 다시 전개
+ */
+
+#pragma once
+
+#include "RewardCore/Interfaces.h"
+#include "RewardCore/RewardArena.h"
+
+namespace RewardCore
+{
+	// 순환 참조 데이터 방어용 최대 전개 깊이
+	constexpr int32 MaxRewardExpandDepth = 16;
+
+	/**
+	 * 보상 묶음 전개
+	 * @param OutRewards 전개된 최종 보상 (추가)
+	 */
+	void ExpandReward(const IRewardData& InData, const FRowId InRewardId, IRandom& InRandom, FPackedRewardArray& OutRewards, const int32 InDepth = 0);
+}
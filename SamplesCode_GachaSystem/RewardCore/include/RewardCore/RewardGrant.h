@@ -0,0 +1,28 @@
+/**
+ * RewardCore - Reward Grant
+ *
+ * 아이템 보상 지급 (병합 → 슬롯 시뮬레이션 → 저장소 반영)
+ * 트랜잭션 경계(시작/커밋/롤백)는 저장소를 가진 호출 측 책임
+ * 중간 배열은 스레드 아레나에서 할당 (호출 종료 시 되감기)
+ */
+
+#pragma once
+
+#include "RewardCore/Interfaces.h"
+
+namespace RewardCore
+{
+	enum class EGrantResult : uint8
+	{
+		Success,
+		InventoryFull,	// 슬롯 시뮬레이션 실패 (저장소 변경 없음)
+		StoreFailed,	// 저장소 반영 실패 (일부 반영 가능, 롤백 필요)
+	};
+
+	/**
+	 * 아이템 보상 지급
+	 * 행 ID 있는 아이템 보상만 처리 (그 외 보상은 호출 측에서 처리)
+	 * @param InAcquireSource 병합된 보상의 획득 경로
+	 */
+	EGrantResult GrantItemRewards(const IRewardData& InData, IInventoryStore& InStore, const FPackedReward* InRewards, const size_t InRewardNum, const uint8 InAcquireSource = 0);
+}
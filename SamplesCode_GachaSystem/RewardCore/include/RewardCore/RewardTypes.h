@@ -0,0 +1,30 @@
+/**
+ * RewardCore - 기본 타입
+ *
+ * 엔진 비의존 코드에서 UE와 같은 이름의 정수 타입 사용
+ * (RewardCore 네임스페이스 내부에만 선언, UE 전역 타입과 충돌 없음)
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace RewardCore
+{
+	using int8 = std::int8_t;
+	using uint8 = std::uint8_t;
+	using int16 = std::int16_t;
+	using uint16 = std::uint16_t;
+	using int32 = std::int32_t;
+	using uint32 = std::uint32_t;
+	using int64 = std::int64_t;
+	using uint64 = std::uint64_t;
+
+	/**
+	 * 행 ID (테이블별 0부터 연속)
+	 * 보상 묶음 → 보상 테이블, 아이템 → 아이템 테이블 기준
+	 */
+	using FRowId = uint32;
+	constexpr FRowId InvalidRowId = UINT32_MAX;
+}
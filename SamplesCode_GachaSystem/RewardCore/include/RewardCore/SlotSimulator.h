@@ -0,0 +1,58 @@
+/**
+ * RewardCore - Inventory Slot Simulator
+ *
+ * 주요 기능:
+ * - 아이템 보상 병합 (스택 가능 아이템 행 ID별 합산)
+ * - 보상 지급 후 인벤토리 슬롯 수 예측 및 용량 초과 판정
+ */
+
+#pragma once
+
+#include "RewardCore/Interfaces.h"
+#include "RewardCore/RewardArena.h"
+
+namespace RewardCore
+{
+	/**
+	 * 아이템 보상 병합
+	 * OutRewards에 [스택 가능 합산(첫 등장 순서), 스택 불가(원본 순서)] 순으로 추가
+	 * 수량 0이 된 보상은 제외
+	 * @param InItems 행 ID가 있는 아이템 보상만
+	 * @param InAcquireSource 병합된 보상의 획득 경로
+	 */
+	void MergeItemRewards(const IRewardData& InData, const FPackedReward* InItems, const size_t InItemNum, const uint8 InAcquireSource, FPackedRewardArray& OutRewards);
+
+	class FSlotSimulator
+	{
+	public:
+		/**
+		 * 현재 인벤토리 슬롯 수/최대 용량에서 시작
+		 */
+		explicit FSlotSimulator(const IInventoryView& InInventory);
+
+		/**
+		 * 아직 인벤토리에 반영되지 않은 아이템 변화 (갱신 대기 아이템)
+		 */
+		void AddPendingChange(const FItemDefinition& InItem, const int32 InAmount);
+
+		/**
+		 * 보상 1개 반영 (스택 가능 아이템은 보유 수량으로 새 슬롯/소진 판단)
+		 * @return 용량 초과 시 false
+		 */
+		bool AddReward(const FItemDefinition& InItem, const FRowId InItemId, const int32 InAmount);
+
+		/**
+		 * 보상 목록 반영 (행 ID 있는 아이템 보상 중 획득 경로 없음(0)만)
+		 * @return 도중에 용량 초과 시 false
+		 */
+		bool AddRewards(const IRewardData& InData, const FPackedReward* InRewards, const size_t InRewardNum);
+
+		int32 GetSlotCount() const { return SlotCount; }
+		bool IsOverCapacity() const { return SlotCount > MaxCapacity; }
+
+	private:
+		const IInventoryView& Inventory;
+		int32 SlotCount = 0;
+		int32 MaxCapacity = 0;
+	};
+}
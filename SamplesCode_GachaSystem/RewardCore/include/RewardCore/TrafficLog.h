@@ -0,0 +1,192 @@
+/**
+ * RewardCore - Traffic Log
+ *
+ * 보상 파이프라인 입력/출력 바이너리 로그 (라이브 캡처 → 결정적 재현)
+ *
+ * 파일 구조:
+ * - FTrafficLogHeader
+ * - 레코드 반복 : FTrafficRecordHeader + 페이로드(PayloadSize 바이트)
+ *
+ * 레코드:
+ * - DataImage : 보상 데이터 사본 (스냅샷 버전이 바뀔 때마다, 이후 레코드의 행 ID 기준)
+ * - Gacha / Expand : 입력 + 난수 시드/위치 + 결과 보상
+ * - Simulate : 아이템 보상 + 조회된 인벤토리 상태 + 병합 결과/슬롯 판정
+ * - InventoryChange : 아이템 수량 변경
+ */
+
+#pragma once
+
+#include "RewardCore/PityStateMachine.h"
+#include "RewardCore/RewardArena.h"
+#include "RewardCore/RewardDefinition.h"
+#include "RewardCore/Interfaces.h"
+
+namespace RewardCore
+{
+	struct FTrafficLogHeader
+	{
+		static constexpr uint32 ExpectedMagic = 0x4C545752;	// 'RWTL'
+		static constexpr uint32 CurrentVersion = 1;
+
+		uint32 Magic = ExpectedMagic;
+		uint32 Version = CurrentVersion;
+	};
+
+	enum class ETrafficRecord : uint16
+	{
+		DataImage = 1,
+		Gacha,
+		Expand,
+		Simulate,
+		InventoryChange,
+	};
+
+	struct FTrafficRecordHeader
+	{
+		uint16 Type = 0;		// ETrafficRecord
+		uint16 Reserved = 0;
+		uint32 PayloadSize = 0;
+		int64 AccountId = 0;
+		int64 Timestamp = 0;	// 기록 측 시각 (UE는 FDateTime 틱)
+		uint64 RandomSeed = 0;	// FDefaultRandom 시드
+		uint64 RandomCounter = 0;	// 작업 시작 시점 생성 횟수
+	};
+
+	static_assert(sizeof(FTrafficRecordHeader) == 40, "FTrafficRecordHeader layout is part of the log format");
+
+	struct FInventoryAmount
+	{
+		FRowId ItemId = InvalidRowId;
+		int32 Amount = 0;
+	};
+
+	struct FGachaTraffic
+	{
+		FRowId RewardId = InvalidRowId;
+		int32 PullCount = 0;
+		FPityConfig Config;
+		FPityState PityBefore;
+		FPityState PityAfter;
+		bool bSucceeded = false;
+		FPackedRewardArray Rewards;
+	};
+
+	struct FExpandTraffic
+	{
+		FRowId RewardId = InvalidRowId;
+		FPackedRewardArray Rewards;
+	};
+
+	enum class ESimulateOutcome : uint8
+	{
+		Passed,
+		InventoryFull,
+		Unchecked,		// 슬롯 검사 생략 또는 코어 밖 검증(URewardManager::Simulate) 실패 → 슬롯 판정 비교 제외
+	};
+
+	struct FSimulateTraffic
+	{
+		uint8 AcquireSource = 0;
+		ESimulateOutcome Outcome = ESimulateOutcome::Passed;
+
+		// 갱신 대기 아이템까지 반영된 시작 슬롯 수
+		int32 SlotCount = 0;
+		int32 MaxCapacity = 0;
+
+		FPackedRewardArray Items;
+		std::vector<FInventoryAmount> Amounts;	// 시뮬레이션 중 조회된 보유 수량
+		FPackedRewardArray Merged;
+	};
+
+	struct FInventoryTraffic
+	{
+		FRowId ItemId = InvalidRowId;
+		int32 Amount = 0;
+		int32 AmountBefore = 0;
+		FItemDefinition Item;
+	};
+
+	/**
+	 * 로그 바이트 생성 (파일 쓰기는 호출 측, UE/네이티브 공용)
+	 */
+	class FTrafficLogWriter
+	{
+	public:
+		/**
+		 * 파일 헤더 (새 파일 시작 시 1회)
+		 */
+		void WriteFileHeader();
+
+		void WriteDataImage(const FTrafficRecordHeader& InHeader, const IRewardData& InData);
+		void WriteGacha(const FTrafficRecordHeader& InHeader, const FGachaTraffic& InTraffic);
+		void WriteExpand(const FTrafficRecordHeader& InHeader, const FExpandTraffic& InTraffic);
+		void WriteSimulate(const FTrafficRecordHeader& InHeader, const FSimulateTraffic& InTraffic);
+		void WriteInventory(const FTrafficRecordHeader& InHeader, const FInventoryTraffic& InTraffic);
+
+		const std::vector<uint8>& GetBuffer() const { return Buffer; }
+		size_t GetSize() const { return Buffer.size(); }
+		void Reset() { Buffer.clear(); }
+
+	private:
+		/**
+		 * 헤더 기록 후 페이로드 시작 위치 반환 (EndRecord에서 크기 기록)
+		 */
+		size_t BeginRecord(const FTrafficRecordHeader& InHeader, const ETrafficRecord InType);
+		void EndRecord(const size_t InHeaderOffset);
+
+		std::vector<uint8> Buffer;
+	};
+
+	/**
+	 * 메모리 상의 로그 순회
+	 */
+	class FTrafficLogReader
+	{
+	public:
+		FTrafficLogReader(const uint8* InData, const size_t InSize);
+
+		bool IsValid() const { return bValid; }
+
+		/**
+		 * 다음 레코드 (끝 또는 손상 시 false)
+		 */
+		bool Next(FTrafficRecordHeader& OutHeader, const uint8*& OutPayload);
+
+		static bool ReadGacha(const uint8* InPayload, const uint32 InSize, FGachaTraffic& OutTraffic);
+		static bool ReadExpand(const uint8* InPayload, const uint32 InSize, FExpandTraffic& OutTraffic);
+		static bool ReadSimulate(const uint8* InPayload, const uint32 InSize, FSimulateTraffic& OutTraffic);
+		static bool ReadInventory(const uint8* InPayload, const uint32 InSize, FInventoryTraffic& OutTraffic);
+
+	private:
+		const uint8* Data = nullptr;
+		size_t Size = 0;
+		size_t Offset = 0;
+		bool bValid = false;
+	};
+
+	/**
+	 * 조회한 보유 수량을 기록하는 인벤토리 조회 래퍼 (Simulate 캡처용)
+	 */
+	class FRecordingInventoryView final : public IInventoryView
+	{
+	public:
+		FRecordingInventoryView(const IInventoryView& InInner, std::vector<FInventoryAmount>& OutAmounts)
+			: Inner(InInner)
+			, Amounts(OutAmounts)
+		{
+		}
+
+		virtual int32 GetItemSlotCount() const override { return Inner.GetItemSlotCount(); }
+		virtual int32 GetMaxCapacity() const override { return Inner.GetMaxCapacity(); }
+		virtual int32 GetAmount(const FRowId InItemId) const override
+		{
+			const int32 Amount = Inner.GetAmount(InItemId);
+			Amounts.push_back({ InItemId, Amount });
+			return Amount;
+		}
+
+	private:
+		const IInventoryView& Inner;
+		std::vector<FInventoryAmount>& Amounts;
+	};
+}
@@ -0,0 +1,72 @@
+/**
+ * RewardCore - Weighted Sampler
+ *
+ * 주요 기능:
+ * - 보상 가중치 누적합 사전 계산 (이진 탐색 추첨)
+ * - 픽업 그룹별 후보 사전 정렬 (천장 보상 즉시 선택)
+ */
+
+#pragma once
+
+#include "RewardCore/PackedReward.h"
+#include <vector>
+
+namespace RewardCore
+{
+	class FWeightedSampler
+	{
+	public:
+		struct FEntry
+		{
+			FPackedReward Reward;
+			int32 PickupGroup = 0;
+		};
+
+		/**
+		 * 후보 추가 (원본 순서대로)
+		 */
+		void AddEntry(const FPackedReward& InReward, const int32 InWeight, const int32 InPickupGroup = 0);
+
+		/**
+		 * 픽업 후보 정렬 (AddEntry 완료 후 1회)
+		 */
+		void Compile();
+
+		/**
+		 * 가중치 추첨 (누적 가중치 이진 탐색, O(log n))
+		 * @param InRandomNumber 1 ~ 총 가중치 범위의 난수
+		 * @return 누적 가중치가 난수 이상이 되는 첫 보상 (없으면 nullptr)
+		 */
+		const FEntry* Roll(const int32 InRandomNumber) const;
+
+		/**
+		 * PickupGroup이 InMinPickupGroup 이상인 후보 수 (O(log n))
+		 */
+		int32 GetPickupCandidateNum(const int32 InMinPickupGroup) const;
+
+		/**
+		 * PickupGroup이 InMinPickupGroup 이상인 후보 중 InIndex 번째
+		 * @param InIndex 0 ~ GetPickupCandidateNum() - 1
+		 */
+		const FEntry* GetPickupCandidate(const int32 InIndex) const;
+
+		bool IsEmpty() const { return Entries.empty(); }
+		int32 Num() const { return static_cast<int32>(Entries.size()); }
+
+		// 원본 순서 후보/가중치 (직렬화용)
+		const FEntry& GetEntry(const int32 InIndex) const { return Entries[InIndex]; }
+		int32 GetWeight(const int32 InIndex) const
+		{
+			return static_cast<int32>(CumulativeWeights[InIndex] - (InIndex > 0 ? CumulativeWeights[InIndex - 1] : 0));
+		}
+
+	private:
+		// 원본 순서 보상 및 누적 가중치
+		std::vector<FEntry> Entries;
+		std::vector<int64> CumulativeWeights;
+
+		// PickupGroup 내림차순 정렬된 Entries 인덱스 (동일 그룹은 원본 순서 유지)
+		std::vector<int32> PickupCandidates;
+		std::vector<int32> PickupGroups;
+	};
+}
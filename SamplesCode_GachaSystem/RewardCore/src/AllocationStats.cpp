@@ -0,0 +1,116 @@
+/**
+ * RewardCore - Allocation Stats Implementation
+ */
+
+#include "RewardCore/AllocationStats.h"
+#include <atomic>
+
+namespace RewardCore
+{
+	namespace
+	{
+		struct FAllocCounters
+		{
+			std::atomic<uint64> Count{ 0 };
+			std::atomic<uint64> TotalBytes{ 0 };
+			std::atomic<int64> LiveBytes{ 0 };
+			std::atomic<int64> PeakBytes{ 0 };
+		};
+
+		FAllocCounters Counters[static_cast<int32>(EAllocTag::Num)];
+		std::atomic<bool> bTrackingActive{ false };
+
+		thread_local EAllocTag CurrentTag = EAllocTag::Untagged;
+	}
+
+	FAllocTagScope::FAllocTagScope(const EAllocTag InTag)
+		: PrevTag(CurrentTag)
+	{
+		CurrentTag = InTag;
+	}
+
+	FAllocTagScope::~FAllocTagScope()
+	{
+		CurrentTag = PrevTag;
+	}
+
+	EAllocTag GetAllocTag()
+	{
+		return CurrentTag;
+	}
+
+	void RecordAlloc(const EAllocTag InTag, const size_t InBytes)
+	{
+		FAllocCounters& Tag = Counters[static_cast<int32>(InTag)];
+		Tag.Count.fetch_add(1, std::memory_order_relaxed);
+		Tag.TotalBytes.fetch_add(InBytes, std::memory_order_relaxed);
+
+		const int64 Live = Tag.LiveBytes.fetch_add(static_cast<int64>(InBytes), std::memory_order_relaxed) + static_cast<int64>(InBytes);
+		int64 Peak = Tag.PeakBytes.load(std::memory_order_relaxed);
+		while (Live > Peak && !Tag.PeakBytes.compare_exchange_weak(Peak, Live, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	void RecordFree(const EAllocTag InTag, const size_t InBytes)
+	{
+		Counters[static_cast<int32>(InTag)].LiveBytes.fetch_sub(static_cast<int64>(InBytes), std::memory_order_relaxed);
+	}
+
+	void SetAllocTrackingActive()
+	{
+		bTrackingActive.store(true, std::memory_order_relaxed);
+	}
+
+	bool IsAllocTrackingActive()
+	{
+		return bTrackingActive.load(std::memory_order_relaxed);
+	}
+
+	FAllocStats GetAllocStats(const EAllocTag InTag)
+	{
+		const FAllocCounters& Tag = Counters[static_cast<int32>(InTag)];
+
+		FAllocStats Stats;
+		Stats.Count = Tag.Count.load(std::memory_order_relaxed);
+		Stats.TotalBytes = Tag.TotalBytes.load(std::memory_order_relaxed);
+		Stats.LiveBytes = Tag.LiveBytes.load(std::memory_order_relaxed);
+		Stats.PeakBytes = Tag.PeakBytes.load(std::memory_order_relaxed);
+		return Stats;
+	}
+
+	FAllocStats GetTotalAllocStats()
+	{
+		FAllocStats Total;
+		for (int32 Index = 0; Index < static_cast<int32>(EAllocTag::Num); ++Index)
+		{
+			const FAllocStats Stats = GetAllocStats(static_cast<EAllocTag>(Index));
+			Total.Count += Stats.Count;
+			Total.TotalBytes += Stats.TotalBytes;
+			Total.LiveBytes += Stats.LiveBytes;
+			Total.PeakBytes += Stats.PeakBytes;
+		}
+		return Total;
+	}
+
+	void ResetAllocPeaks()
+	{
+		for (FAllocCounters& Tag : Counters)
+		{
+			Tag.PeakBytes.store(Tag.LiveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		}
+	}
+
+	const char* GetAllocTagName(const EAllocTag InTag)
+	{
+		switch (InTag)
+		{
+		case EAllocTag::Untagged:	return "untagged";
+		case EAllocTag::Reward:		return "reward";
+		case EAllocTag::Inventory:	return "inventory";
+		case EAllocTag::Video:		return "video";
+		case EAllocTag::Subtitle:	return "subtitle";
+		default:					return "unknown";
+		}
+	}
+}
@@ -0,0 +1,80 @@
+/**
+ * RewardCore - Default Random Implementation
+ */
+
+#include "RewardCore/DefaultRandom.h"
+
+namespace RewardCore
+{
+	namespace
+	{
+		uint64 SplitMix64(uint64& InOutState)
+		{
+			uint64 Value = (InOutState += 0x9E3779B97F4A7C15ull);
+			Value = (Value ^ (Value >> 30)) * 0xBF58476D1CE4E5B9ull;
+			Value = (Value ^ (Value >> 27)) * 0x94D049BB133111EBull;
+			return Value ^ (Value >> 31);
+		}
+
+		uint64 RotateLeft(const uint64 InValue, const int InShift)
+		{
+			return (InValue << InShift) | (InValue >> (64 - InShift));
+		}
+	}
+
+	FDefaultRandom::FDefaultRandom(const uint64 InSeed/* = 0*/)
+	{
+		Seed(InSeed);
+	}
+
+	void FDefaultRandom::Seed(const uint64 InSeed)
+	{
+		SeedValue = InSeed;
+		Counter = 0;
+
+		uint64 SeedState = InSeed;
+		for (uint64& Word : State)
+		{
+			Word = SplitMix64(SeedState);
+		}
+	}
+
+	uint64 FDefaultRandom::Next()
+	{
+		const uint64 Result = RotateLeft(State[1] * 5, 7) * 9;
+		const uint64 Temp = State[1] << 17;
+
+		State[2] ^= State[0];
+		State[3] ^= State[1];
+		State[1] ^= State[2];
+		State[0] ^= State[3];
+		State[2] ^= Temp;
+		State[3] = RotateLeft(State[3], 45);
+
+		++Counter;
+		return Result;
+	}
+
+	void FDefaultRandom::Discard(const uint64 InCount)
+	{
+		for (uint64 Index = 0; Index < InCount; ++Index)
+		{
+			Next();
+		}
+	}
+
+	/**
+	 * 상위 32비트 × 범위 곱셈 축소 (나눗셈 없음, 가챠 가중치 범위에서 편향 무시 가능)
+	 */
+	int32 FDefaultRandom::RandRange(const int32 InMin, const int32 InMax)
+	{
+		if (InMax <= InMin)
+		{
+			return InMin;
+		}
+
+		const uint64 Range = static_cast<uint64>(static_cast<int64>(InMax) - InMin) + 1;
+		const uint64 Offset = ((Next() >> 32) * Range) >> 32;
+		return static_cast<int32>(InMin + static_cast<int64>(Offset));
+	}
+}
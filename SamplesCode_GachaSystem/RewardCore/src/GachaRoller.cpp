@@ -0,0 +1,120 @@
+/**
+ * RewardCore - Gacha Roller Implementation
+ *
+ * 기술 하이라이트:
+ * - 천장 판정은 FPityStateMachine, 추첨은 FWeightedSampler에 위임
+ * - 난수/피티 저장소는 인터페이스로 주입 (엔진/DB 비의존)
+ */
+
+#include "RewardCore/GachaRoller.h"
+#include "RewardCore/AllocationStats.h"
+
+namespace RewardCore
+{
+	/**
+	 * 픽업 그룹 기반 보상 선택
+	 *
+	 * 로직:
+	 * - 특정 PickupGroup 이상의 보상 후보 수 조회 (추첨기에 사전 정렬)
+	 * - 랜덤하게 하나 선택
+	 */
+	FPackedReward PickupReward(const FWeightedSampler& InSampler, const int32 InPickupGroup, IRandom& InRandom)
+	{
+		const int32 CandidateNum = InSampler.GetPickupCandidateNum(InPickupGroup);
+		if (CandidateNum <= 0)
+		{
+			// 로그 : [Gacha] No data for PickupGroup >= %d", InPickupGroup;
+			return FPackedReward();
+		}
+
+		// 랜덤 선택
+		const int32 Index = InRandom.RandRange(0, CandidateNum - 1);
+
+		// 로그 : [Gacha] Pickup reward: %s (PickupGroup=%d)
+		return InSampler.GetPickupCandidate(Index)->Reward;
+	}
+
+	/**
+	 * 가중치 기반 랜덤 보상 추첨
+	 *
+	 * 알고리즘:
+	 * 1. 1부터 총 가중치 사이의 랜덤 값 생성
+	 * 2. 누적 가중치가 랜덤 값 이상인 첫 번째 보상 선택 (사전 계산된 누적 가중치 이진 탐색)
+	 *
+	 * 예시:
+	 * - 보상A (가중치 70): 1~70 범위
+	 * - 보상B (가중치 25): 71~95 범위
+	 * - 보상C (가중치 5):  96~100 범위
+	 */
+	FPackedReward RollReward(const FWeightedSampler& InSampler, const int32 InTotalWeight, IRandom& InRandom, int32& OutPickupGroup)
+	{
+		const int32 RandomNumber{ InRandom.RandRange(1, InTotalWeight) };
+
+		if (const FWeightedSampler::FEntry* Entry = InSampler.Roll(RandomNumber))
+		{
+			OutPickupGroup = Entry->PickupGroup;
+			// 로그 : [Gacha] Random reward: %s (PickupGroup=%d, Weight=%d)
+			return Entry->Reward;
+		}
+
+		// 로그 : [Gacha] RollReward failed
+		return FPackedReward();
+	}
+
+	bool PullGacha(const FRewardDefinition& InReward, const FPityConfig& InConfig, FPityState& InOutState, const int32 InPullCount, IRandom& InRandom, FPackedRewardArray& OutRewards)
+	{
+		if (InReward.TotalGachaWeight <= 0 || InPullCount <= 0)
+		{
+			return false;
+		}
+
+		FAllocTagScope AllocTag(EAllocTag::Reward);
+
+		OutRewards.reserve(OutRewards.size() + InPullCount);
+
+		FPityStateMachine Pity(InConfig, InOutState);
+		for (int32 Index = 0; Index < InPullCount; ++Index)
+		{
+			const EPityAction Action = Pity.BeginPull();
+			if (Action != EPityAction::Roll)
+			{
+				OutRewards.emplace_back(PickupReward(InReward.Gacha, Pity.GetPickupGroup(Action), InRandom));
+				continue;
+			}
+
+			int32 PickupGroup = 0;
+			OutRewards.emplace_back(RollReward(InReward.Gacha, InReward.TotalGachaWeight, InRandom, PickupGroup));
+			Pity.OnRolled(PickupGroup);
+		}
+
+		InOutState = Pity.GetState();
+		return true;
+	}
+
+	/**
+	 * 피티 카운터 로드 → 뽑기 → 저장
+	 * (뽑기 불가 시 저장하지 않음)
+	 */
+	bool PullGacha(const IRewardData& InData, IPityStore& InPityStore, IRandom& InRandom, const FRowId InRewardId, const FPityConfig& InConfig, const int32 InPullCount, FPackedRewardArray& OutRewards)
+	{
+		const FRewardDefinition* Reward = InData.GetRewardDefinition(InRewardId);
+		if (!Reward)
+		{
+			return false;
+		}
+
+		FPityState State;
+		InPityStore.LoadPity(InRewardId, State);
+
+		const size_t PrevNum = OutRewards.size();
+		if (!PullGacha(*Reward, InConfig, State, InPullCount, InRandom, OutRewards))
+		{
+			return false;
+		}
+
+		// 로그 : [Reward_Gacha] Normal : %d/%d, Special : %d/%d
+		InPityStore.SavePity(InRewardId, State);
+
+		return OutRewards.size() - PrevNum == static_cast<size_t>(InPullCount);
+	}
+}
@@ -0,0 +1,200 @@
+/**
+ * RewardCore - Inventory Reservation Ledger Implementation
+ */
+
+#include "RewardCore/InventoryLedger.h"
+
+namespace RewardCore
+{
+	FInventoryLedger::FLedgerView::FLedgerView(FInventoryLedger& InLedger, const uint64 InAccountId, const IInventoryView& InCommitted)
+		: Shard(InLedger.GetShard(InAccountId))
+		, Lock(Shard.Mutex)
+		, AccountId(InAccountId)
+		, Committed(InCommitted)
+	{
+		const auto It = Shard.Accounts.find(InAccountId);
+		Account = It != Shard.Accounts.end() ? &It->second : nullptr;
+	}
+
+	int32 FInventoryLedger::FLedgerView::GetItemSlotCount() const
+	{
+		return Committed.GetItemSlotCount() + (Account ? Account->GetReservedSlots() : 0);
+	}
+
+	/**
+	 * 예약 중인 아이템은 반영분 또는 예약된 스택 슬롯이 있으므로
+	 * 시뮬레이터는 기존 스택에 쌓는 것으로 판정 (새 슬롯 없음)
+	 */
+	int32 FInventoryLedger::FLedgerView::GetAmount(const FRowId InItemId) const
+	{
+		const int32 Amount = Committed.GetAmount(InItemId);
+		const FItemReservation* Reserved = Account ? Account->FindItem(InItemId) : nullptr;
+		return Reserved ? Amount + Reserved->Amount : Amount;
+	}
+
+	FReservationId FInventoryLedger::FLedgerView::Reserve(const IRewardData& InData, const FPackedReward* InRewards, const size_t InRewardNum)
+	{
+		uint32 Slot = 0;
+		if (!Shard.FreeReservations.empty())
+		{
+			Slot = Shard.FreeReservations.back();
+			Shard.FreeReservations.pop_back();
+		}
+		else
+		{
+			Slot = static_cast<uint32>(Shard.Reservations.size());
+			Shard.Reservations.emplace_back();
+		}
+
+		FReservation& Reservation = Shard.Reservations[Slot];
+		Reservation.AccountId = AccountId;
+		Reservation.NonStackableSlots = 0;
+		Reservation.Items.clear();
+
+		for (size_t i = 0; i < InRewardNum; ++i)
+		{
+			const FPackedReward& Reward = InRewards[i];
+			if (!Reward.IsItem() || !Reward.HasRowId() || Reward.AcquireSource != 0 || Reward.Amount <= 0)
+			{
+				continue;
+			}
+
+			const FItemDefinition* Item = InData.GetItemDefinition(Reward.Id);
+			if (!Item || !Item->bRequiresInventorySlot)
+			{
+				continue;
+			}
+
+			if (Item->bNonStackable)
+			{
+				Reservation.NonStackableSlots += Reward.Amount;
+				continue;
+			}
+
+			FItemReservation& Reserved = Reservation.Items.emplace_back();
+			Reserved.ItemId = Reward.Id;
+			Reserved.Amount = Reward.Amount;
+			Reserved.StackRefs = 1;
+
+			// 이미 보유 중이면 기존 스택에 쌓이므로 수량만 예약
+			Reserved.bSlotReserved = Committed.GetAmount(Reward.Id) == 0;
+		}
+
+		if (Reservation.NonStackableSlots == 0 && Reservation.Items.empty())
+		{
+			Shard.FreeReservations.push_back(Slot);
+			return InvalidReservationId;
+		}
+
+		FAccount& Target = Shard.Accounts[AccountId];
+		Target.NonStackableSlots += Reservation.NonStackableSlots;
+		++Target.ReservationNum;
+		for (const FItemReservation& Reserved : Reservation.Items)
+		{
+			FItemReservation* Existing = const_cast<FItemReservation*>(Target.FindItem(Reserved.ItemId));
+			if (!Existing)
+			{
+				Existing = &Target.Items.emplace_back();
+				Existing->ItemId = Reserved.ItemId;
+			}
+
+			Existing->Amount += Reserved.Amount;
+			Existing->StackRefs += Reserved.StackRefs;
+
+			// 다른 예약이 이미 스택 슬롯을 잡았으면 추가 예약 없음
+			if (Reserved.bSlotReserved && !Existing->bSlotReserved)
+			{
+				Existing->bSlotReserved = true;
+				++Target.StackSlots;
+			}
+		}
+		Account = &Target;
+
+		Reservation.bActive = true;
+		++Reservation.Generation;
+
+		// 로그 : [Ledger] Reserve account=%llu slots=%d
+		const uint64 Handle = (static_cast<uint64>(Reservation.Generation) << 32) | Slot;
+		return (Handle << ShardBits) | (AccountId % ShardNum);
+	}
+
+	const FInventoryLedger::FItemReservation* FInventoryLedger::FAccount::FindItem(const FRowId InItemId) const
+	{
+		for (const FItemReservation& Item : Items)
+		{
+			if (Item.ItemId == InItemId)
+			{
+				return &Item;
+			}
+		}
+		return nullptr;
+	}
+
+	int32 FInventoryLedger::GetReservedSlots(const uint64 InAccountId)
+	{
+		FShard& Shard = GetShard(InAccountId);
+		std::lock_guard<std::mutex> Lock(Shard.Mutex);
+
+		const auto It = Shard.Accounts.find(InAccountId);
+		return It != Shard.Accounts.end() ? It->second.GetReservedSlots() : 0;
+	}
+
+	void FInventoryLedger::Remove(const FReservationId InReservationId)
+	{
+		if (InReservationId == InvalidReservationId)
+		{
+			return;
+		}
+
+		FShard& Shard = Shards[InReservationId % ShardNum];
+		const uint64 Handle = InReservationId >> ShardBits;
+		const uint32 Slot = static_cast<uint32>(Handle);
+		const uint32 Generation = static_cast<uint32>(Handle >> 32);
+
+		std::lock_guard<std::mutex> Lock(Shard.Mutex);
+
+		if (Slot >= Shard.Reservations.size() || !Shard.Reservations[Slot].bActive || (Shard.Reservations[Slot].Generation & (UINT32_MAX >> ShardBits)) != Generation)
+		{
+			// 로그 : [Ledger] Unknown reservation %llu
+			return;
+		}
+
+		FReservation& Reservation = Shard.Reservations[Slot];
+		const auto AccountIt = Shard.Accounts.find(Reservation.AccountId);
+		if (AccountIt != Shard.Accounts.end())
+		{
+			FAccount& Account = AccountIt->second;
+			Account.NonStackableSlots -= Reservation.NonStackableSlots;
+			--Account.ReservationNum;
+
+			for (const FItemReservation& Reserved : Reservation.Items)
+			{
+				FItemReservation* Item = const_cast<FItemReservation*>(Account.FindItem(Reserved.ItemId));
+				if (!Item)
+				{
+					continue;
+				}
+
+				Item->Amount -= Reserved.Amount;
+				Item->StackRefs -= Reserved.StackRefs;
+				if (Item->StackRefs <= 0)
+				{
+					if (Item->bSlotReserved)
+					{
+						--Account.StackSlots;
+					}
+					*Item = Account.Items.back();
+					Account.Items.pop_back();
+				}
+			}
+
+			if (Account.ReservationNum <= 0 && Shard.Accounts.size() > MaxIdleAccounts)
+			{
+				Shard.Accounts.erase(AccountIt);
+			}
+		}
+
+		Reservation.bActive = false;
+		Shard.FreeReservations.push_back(Slot);
+	}
+}
@@ -0,0 +1,65 @@
+/**
+ * RewardCore - Pity State Machine Implementation
+ */
+
+#include "RewardCore/PityStateMachine.h"
+
+namespace RewardCore
+{
+	FPityStateMachine::FPityStateMachine(const FPityConfig& InConfig, const FPityState& InState)
+		: Config(InConfig)
+		, State(InState)
+	{
+	}
+
+	/**
+	 * 판정 순서:
+	 * 1. Special Pity (최고 등급 천장) : 두 카운터 모두 초기화
+	 * 2. Normal Pity (10회 천장) : 일반 카운터만 초기화
+	 * 3. 그 외 일반 추첨
+	 */
+	EPityAction FPityStateMachine::BeginPull()
+	{
+		++State.NormalCounter;
+		++State.SpecialCounter;
+
+		if (Config.SpecialPickupGroup > 0 && State.SpecialCounter >= Config.SpecialTryCount)
+		{
+			State.SpecialCounter = 0;
+			State.NormalCounter = 0;
+			return EPityAction::Special;
+		}
+
+		if (Config.NormalPickupGroup > 0 && State.NormalCounter >= Config.NormalTryCount)
+		{
+			State.NormalCounter = 0;
+			return EPityAction::Normal;
+		}
+
+		return EPityAction::Roll;
+	}
+
+	void FPityStateMachine::OnRolled(const int32 InPickupGroup)
+	{
+		// 높은 등급 획득 시 카운터 리셋
+		if (InPickupGroup >= Config.SpecialPickupGroup)
+		{
+			State.SpecialCounter = 0;
+			State.NormalCounter = 0;
+		}
+		else if (InPickupGroup >= Config.NormalPickupGroup)
+		{
+			State.NormalCounter = 0;
+		}
+	}
+
+	int32 FPityStateMachine::GetPickupGroup(const EPityAction InAction) const
+	{
+		switch (InAction)
+		{
+		case EPityAction::Special:	return Config.SpecialPickupGroup;
+		case EPityAction::Normal:	return Config.NormalPickupGroup;
+		default:					return 0;
+		}
+	}
+}
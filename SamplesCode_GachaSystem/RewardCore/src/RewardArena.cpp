@@ -0,0 +1,85 @@
+/**
+ * RewardCore - Reward Arena Implementation
+ */
+
+#include "RewardCore/RewardArena.h"
+#include <algorithm>
+#include <cstdint>
+
+namespace RewardCore
+{
+	FRewardArena::FRewardArena(const size_t InBlockSize/* = 64 * 1024*/)
+		: BlockSize(InBlockSize)
+	{
+	}
+
+	FRewardArena::~FRewardArena()
+	{
+		for (const FBlock& Block : Blocks)
+		{
+			::operator delete(Block.Data);
+		}
+	}
+
+	/**
+	 * 현재 블록에서 정렬 후 잘라 쓰기
+	 * 부족하면 다음 블록으로 (되감기 후 남은 블록 재사용, 없으면 2배 크기로 새 블록)
+	 */
+	void* FRewardArena::Allocate(const size_t InSize, const size_t InAlignment)
+	{
+		for (; Current < Blocks.size(); ++Current, Offset = 0)
+		{
+			const FBlock& Block = Blocks[Current];
+			const uintptr_t Address = reinterpret_cast<uintptr_t>(Block.Data) + Offset;
+			const size_t Aligned = Offset + ((InAlignment - Address % InAlignment) % InAlignment);
+			if (Aligned + InSize <= Block.Size)
+			{
+				Offset = Aligned + InSize;
+				return Block.Data + Aligned;
+			}
+		}
+
+		const size_t NewSize = std::max(Blocks.empty() ? BlockSize : Blocks.back().Size * 2, InSize + InAlignment);
+		FBlock& Block = Blocks.emplace_back();
+		Block.Data = static_cast<uint8*>(::operator new(NewSize));
+		Block.Size = NewSize;
+
+		Current = Blocks.size() - 1;
+		const uintptr_t Address = reinterpret_cast<uintptr_t>(Block.Data);
+		const size_t Aligned = (InAlignment - Address % InAlignment) % InAlignment;
+		Offset = Aligned + InSize;
+		return Block.Data + Aligned;
+	}
+
+	void FRewardArena::Rewind(const FMark& InMark)
+	{
+		Current = InMark.Block;
+		Offset = InMark.Offset;
+	}
+
+	size_t FRewardArena::GetUsedBytes() const
+	{
+		size_t Used = Offset;
+		for (size_t Index = 0; Index < Current && Index < Blocks.size(); ++Index)
+		{
+			Used += Blocks[Index].Size;
+		}
+		return Used;
+	}
+
+	size_t FRewardArena::GetReservedBytes() const
+	{
+		size_t Reserved = 0;
+		for (const FBlock& Block : Blocks)
+		{
+			Reserved += Block.Size;
+		}
+		return Reserved;
+	}
+
+	FRewardArena& FRewardArena::GetThreadArena()
+	{
+		thread_local FRewardArena Arena;
+		return Arena;
+	}
+}
@@ -0,0 +1,145 @@
+/**
+ * RewardCore - Reward Data Image Implementation
+ *
+ * 직렬화 구조:
+ * - 보상 수, 아이템 수
+ * - 보상별 : Statics, TotalWeight, Randoms 후보, TotalGachaWeight, Gacha 후보
+ * - 아이템별 : FItemDefinition
+ */
+
+#include "RewardCore/RewardDataImage.h"
+#include "RewardCore/ByteStream.h"
+
+namespace RewardCore
+{
+	namespace
+	{
+		struct FSamplerEntryImage
+		{
+			FPackedReward Reward;
+			int32 Weight = 0;
+			int32 PickupGroup = 0;
+		};
+
+		void CopySampler(const FWeightedSampler& InSource, FWeightedSampler& OutSampler)
+		{
+			OutSampler = FWeightedSampler();
+			for (int32 Index = 0; Index < InSource.Num(); ++Index)
+			{
+				const FWeightedSampler::FEntry& Entry = InSource.GetEntry(Index);
+				OutSampler.AddEntry(Entry.Reward, InSource.GetWeight(Index), Entry.PickupGroup);
+			}
+			OutSampler.Compile();
+		}
+
+		void WriteSampler(FByteWriter& InWriter, const FWeightedSampler& InSampler)
+		{
+			std::vector<FSamplerEntryImage> Entries;
+			Entries.reserve(InSampler.Num());
+			for (int32 Index = 0; Index < InSampler.Num(); ++Index)
+			{
+				const FWeightedSampler::FEntry& Entry = InSampler.GetEntry(Index);
+				Entries.push_back({ Entry.Reward, InSampler.GetWeight(Index), Entry.PickupGroup });
+			}
+			InWriter.WriteArray(Entries);
+		}
+
+		bool ReadSampler(FByteReader& InReader, FWeightedSampler& OutSampler)
+		{
+			std::vector<FSamplerEntryImage> Entries;
+			if (!InReader.ReadArray(Entries))
+			{
+				return false;
+			}
+
+			OutSampler = FWeightedSampler();
+			for (const FSamplerEntryImage& Entry : Entries)
+			{
+				OutSampler.AddEntry(Entry.Reward, Entry.Weight, Entry.PickupGroup);
+			}
+			OutSampler.Compile();
+			return true;
+		}
+	}
+
+	void FRewardDataImage::Capture(const IRewardData& InData)
+	{
+		Rewards.clear();
+		Rewards.resize(InData.GetRewardDefinitionNum());
+		for (int32 Index = 0; Index < InData.GetRewardDefinitionNum(); ++Index)
+		{
+			const FRewardDefinition* Source = InData.GetRewardDefinition(static_cast<FRowId>(Index));
+			if (!Source)
+			{
+				continue;
+			}
+
+			FRewardDefinition& Reward = Rewards[Index];
+			Reward.Statics = Source->Statics;
+			Reward.TotalWeight = Source->TotalWeight;
+			Reward.TotalGachaWeight = Source->TotalGachaWeight;
+			CopySampler(Source->Randoms, Reward.Randoms);
+			CopySampler(Source->Gacha, Reward.Gacha);
+		}
+
+		Items.clear();
+		Items.resize(InData.GetItemDefinitionNum());
+		for (int32 Index = 0; Index < InData.GetItemDefinitionNum(); ++Index)
+		{
+			if (const FItemDefinition* Source = InData.GetItemDefinition(static_cast<FRowId>(Index)))
+			{
+				Items[Index] = *Source;
+			}
+		}
+	}
+
+	void FRewardDataImage::Serialize(std::vector<uint8>& OutBuffer) const
+	{
+		FByteWriter Writer(OutBuffer);
+		Writer.Write(static_cast<uint32>(Rewards.size()));
+		for (const FRewardDefinition& Reward : Rewards)
+		{
+			Writer.WriteArray(Reward.Statics);
+			Writer.Write(Reward.TotalWeight);
+			WriteSampler(Writer, Reward.Randoms);
+			Writer.Write(Reward.TotalGachaWeight);
+			WriteSampler(Writer, Reward.Gacha);
+		}
+		Writer.WriteArray(Items);
+	}
+
+	bool FRewardDataImage::Deserialize(const uint8* InData, const size_t InSize)
+	{
+		FByteReader Reader(InData, InSize);
+
+		uint32 RewardNum = 0;
+		if (!Reader.Read(RewardNum))
+		{
+			return false;
+		}
+
+		Rewards.clear();
+		for (uint32 Index = 0; Index < RewardNum && Reader.IsValid(); ++Index)
+		{
+			FRewardDefinition& Reward = Rewards.emplace_back();
+			Reader.ReadArray(Reward.Statics);
+			Reader.Read(Reward.TotalWeight);
+			ReadSampler(Reader, Reward.Randoms);
+			Reader.Read(Reward.TotalGachaWeight);
+			ReadSampler(Reader, Reward.Gacha);
+		}
+		Reader.ReadArray(Items);
+
+		return Reader.IsValid() && Reader.IsEnd();
+	}
+
+	const FRewardDefinition* FRewardDataImage::GetRewardDefinition(const FRowId InRewardId) const
+	{
+		return InRewardId < Rewards.size() ? &Rewards[InRewardId] : nullptr;
+	}
+
+	const FItemDefinition* FRewardDataImage::GetItemDefinition(const FRowId InItemId) const
+	{
+		return InItemId < Items.size() ? &Items[InItemId] : nullptr;
+	}
+}
@@ -0,0 +1,68 @@
+/**
+ * RewardCore - Reward Expander Implementation
+ *
+ * 하위 보상팩도 같은 데이터 소스에서 행 ID로 조회 (이름 해시 없음)
+ */
+
+#include "RewardCore/RewardExpander.h"
+#include "RewardCore/AllocationStats.h"
+
+namespace RewardCore
+{
+	void ExpandReward(const IRewardData& InData, const FRowId InRewardId, IRandom& InRandom, FPackedRewardArray& OutRewards, const int32 InDepth/* = 0*/)
+	{
+		if (InDepth >= MaxRewardExpandDepth)
+		{
+			// 로그 : [Reward] Expand depth exceeded (cyclic reward data?) %u
+			return;
+		}
+
+		const FRewardDefinition* RewardData = InData.GetRewardDefinition(InRewardId);
+		if (!RewardData)
+		{
+			return;
+		}
+
+		// 로그 : [Reward] Build %s => StaticCount[%d] RandomCount[%d]
+
+		FAllocTagScope AllocTag(EAllocTag::Reward);
+
+		OutRewards.reserve(OutRewards.size() + RewardData->Statics.size() + 1);
+
+		auto AddReward = [&](const FPackedReward& Reward)
+		{
+			// 보상 묶음은 재귀적으로 전개
+			if (Reward.IsBundle())
+			{
+				const FRowId RowId = Reward.HasRowId() ? Reward.Id : InvalidRowId;
+				for (int32 i = 0; i < Reward.Amount; ++i)
+				{
+					ExpandReward(InData, RowId, InRandom, OutRewards, InDepth + 1);
+				}
+			}
+			else
+			{
+				OutRewards.emplace_back(Reward);
+			}
+		};
+
+		// 고정 보상 추가
+		for (const FPackedReward& Reward : RewardData->Statics)
+		{
+			AddReward(Reward);
+		}
+
+		// 랜덤 보상 추첨
+		if (!RewardData->Randoms.IsEmpty())
+		{
+			const int32 RandomNumber{ InRandom.RandRange(1, RewardData->TotalWeight) };
+			// 로그 : [Reward] %s: Random Start; %d/%d
+
+			if (const FWeightedSampler::FEntry* Entry = RewardData->Randoms.Roll(RandomNumber))
+			{
+				// 로그 : [Reward] Select: %s
+				AddReward(Entry->Reward);
+			}
+		}
+	}
+}
@@ -0,0 +1,53 @@
+/**
+ * RewardCore - Reward Grant Implementation
+ */
+
+#include "RewardCore/RewardGrant.h"
+#include "RewardCore/AllocationStats.h"
+#include "RewardCore/RewardArena.h"
+#include "RewardCore/SlotSimulator.h"
+
+namespace RewardCore
+{
+	/**
+	 * 순서:
+	 * 1. 아이템 보상만 모아 스택 병합 (SimulateRewards 1~2단계)
+	 * 2. 슬롯 시뮬레이션, 초과 시 저장소를 건드리지 않고 실패
+	 * 3. 병합된 보상 순서대로 저장소 반영
+	 */
+	EGrantResult GrantItemRewards(const IRewardData& InData, IInventoryStore& InStore, const FPackedReward* InRewards, const size_t InRewardNum, const uint8 InAcquireSource/* = 0*/)
+	{
+		FAllocTagScope AllocTag(EAllocTag::Inventory);
+		const FRewardArenaScope ArenaScope;
+
+		FPackedRewardArray Items(ArenaScope.GetArena());
+		Items.reserve(InRewardNum);
+		for (size_t i = 0; i < InRewardNum; ++i)
+		{
+			if (InRewards[i].IsItem() && InRewards[i].HasRowId())
+			{
+				Items.emplace_back(InRewards[i]);
+			}
+		}
+
+		FPackedRewardArray Merged(ArenaScope.GetArena());
+		MergeItemRewards(InData, Items.data(), Items.size(), InAcquireSource, Merged);
+
+		FSlotSimulator Slots(InStore);
+		if (!Slots.AddRewards(InData, Merged.data(), Merged.size()))
+		{
+			return EGrantResult::InventoryFull;
+		}
+
+		for (const FPackedReward& Reward : Merged)
+		{
+			if (!InStore.ApplyItem(Reward.Id, *InData.GetItemDefinition(Reward.Id), Reward.Amount))
+			{
+				// 로그 : [Reward] ApplyItem failed: %u (%d)
+				return EGrantResult::StoreFailed;
+			}
+		}
+
+		return EGrantResult::Success;
+	}
+}
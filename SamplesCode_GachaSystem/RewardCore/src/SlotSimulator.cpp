@@ -0,0 +1,191 @@
+/**
+ * RewardCore - Inventory Slot Simulator Implementation
+ *
+ * 기술 하이라이트:
+ * - 스택 병합은 아이템 행 ID → 병합 슬롯 직접 인덱싱 (해시 없음)
+ * - 병합 테이블은 스레드별 재사용, 사용 후 건드린 칸만 복구
+ */
+
+#include "RewardCore/SlotSimulator.h"
+#include "RewardCore/AllocationStats.h"
+#include <algorithm>
+#include <cstdlib>
+
+namespace RewardCore
+{
+	namespace
+	{
+		constexpr int32 NoStackSlot = -1;
+
+		/**
+		 * 아이템 행 ID → 병합 슬롯 (스레드별 재사용)
+		 */
+		std::vector<int32>& GetStackSlotByItem(const int32 InItemNum)
+		{
+			thread_local std::vector<int32> StackSlotByItem;
+			if (static_cast<int32>(StackSlotByItem.size()) < InItemNum)
+			{
+				StackSlotByItem.resize(InItemNum, NoStackSlot);
+			}
+			return StackSlotByItem;
+		}
+	}
+
+	void MergeItemRewards(const IRewardData& InData, const FPackedReward* InItems, const size_t InItemNum, const uint8 InAcquireSource, FPackedRewardArray& OutRewards)
+	{
+		FAllocTagScope AllocTag(EAllocTag::Inventory);
+
+		std::vector<int32>& StackSlotByItem = GetStackSlotByItem(InData.GetItemDefinitionNum());
+
+		const size_t StackableBegin = OutRewards.size();
+		// 출력과 같은 아레나 사용 (아레나 없으면 힙)
+		FPackedRewardArray NonStackables(OutRewards.get_allocator());
+
+		for (size_t i = 0; i < InItemNum; ++i)
+		{
+			const FPackedReward& Reward = InItems[i];
+			const FItemDefinition* Item = InData.GetItemDefinition(Reward.Id);
+			if (!Item)
+			{
+				continue;
+			}
+
+			// 스택 불가능 아이템 (무기, 방어구 등)
+			if (Item->bNonStackable)
+			{
+				NonStackables.emplace_back(Reward);
+				continue;
+			}
+
+			// 스택 가능 아이템 (소비 아이템 등) - 병합
+			int32& StackSlot = StackSlotByItem[Reward.Id];
+			if (StackSlot == NoStackSlot)
+			{
+				FPackedReward& Merged = OutRewards.emplace_back();
+				Merged.Id = Reward.Id;
+				Merged.Flags = FPackedReward::Item;
+				Merged.RewardType = Reward.RewardType;
+				Merged.AcquireSource = InAcquireSource;
+				StackSlot = static_cast<int32>(OutRewards.size() - 1);
+			}
+			OutRewards[StackSlot].Amount += Reward.Amount;
+		}
+
+		for (size_t i = StackableBegin; i < OutRewards.size(); ++i)
+		{
+			StackSlotByItem[OutRewards[i].Id] = NoStackSlot;
+		}
+
+		OutRewards.erase(std::remove_if(OutRewards.begin() + StackableBegin, OutRewards.end(), [](const FPackedReward& Merged) { return Merged.Amount == 0; }), OutRewards.end());
+		OutRewards.insert(OutRewards.end(), NonStackables.begin(), NonStackables.end());
+	}
+
+	FSlotSimulator::FSlotSimulator(const IInventoryView& InInventory)
+		: Inventory(InInventory)
+		, SlotCount(InInventory.GetItemSlotCount())
+		, MaxCapacity(InInventory.GetMaxCapacity())
+	{
+	}
+
+	void FSlotSimulator::AddPendingChange(const FItemDefinition& InItem, const int32 InAmount)
+	{
+		if (!InItem.bRequiresInventorySlot)
+		{
+			return;
+		}
+
+		// 스택 불가능 아이템
+		if (InItem.bNonStackable)
+		{
+			if (InAmount > 0)
+			{
+				SlotCount += InAmount;  // 추가
+			}
+			else if (InAmount < 0)
+			{
+				SlotCount -= std::abs(InAmount);  // 제거
+			}
+		}
+		// 스택 가능 아이템
+		else
+		{
+			SlotCount += (InAmount > 0 ? 1 : -1);
+		}
+	}
+
+	bool FSlotSimulator::AddReward(const FItemDefinition& InItem, const FRowId InItemId, const int32 InAmount)
+	{
+		if (!InItem.bRequiresInventorySlot)
+		{
+			return true;
+		}
+
+		const int32 UserAmount = Inventory.GetAmount(InItemId);
+
+		// 스택 불가능 아이템
+		if (InItem.bNonStackable)
+		{
+			if (InAmount > 0)
+			{
+				SlotCount += InAmount;
+			}
+			else if (InAmount < 0)
+			{
+				SlotCount -= std::min(UserAmount, -InAmount);
+			}
+		}
+		// 스택 가능 아이템
+		else
+		{
+			if (InAmount > 0)
+			{
+				// 새로운 아이템이면 슬롯 +1 (기존 아이템에 스택 시 슬롯 변화 없음)
+				if (UserAmount == 0)
+				{
+					++SlotCount;
+				}
+			}
+			else if (InAmount < 0)
+			{
+				// 아이템이 완전히 소진되면 슬롯 -1
+				if (UserAmount + InAmount <= 0)
+				{
+					--SlotCount;
+				}
+			}
+		}
+
+		// 용량 초과 체크
+		if (IsOverCapacity())
+		{
+			// 로그 : Inventory Full;
+			return false;
+		}
+		return true;
+	}
+
+	bool FSlotSimulator::AddRewards(const IRewardData& InData, const FPackedReward* InRewards, const size_t InRewardNum)
+	{
+		for (size_t i = 0; i < InRewardNum; ++i)
+		{
+			const FPackedReward& Reward = InRewards[i];
+			if (!Reward.IsItem() || !Reward.HasRowId() || Reward.AcquireSource != 0)
+			{
+				continue;
+			}
+
+			const FItemDefinition* Item = InData.GetItemDefinition(Reward.Id);
+			if (!Item)
+			{
+				// 로그 : ItemData not found: %u
+				continue;
+			}
+
+			if (!AddReward(*Item, Reward.Id, Reward.Amount))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
@@ -0,0 +1,177 @@
+/**
+ * RewardCore - Traffic Log Implementation
+ */
+
+#include "RewardCore/TrafficLog.h"
+#include "RewardCore/ByteStream.h"
+#include "RewardCore/RewardDataImage.h"
+#include <cstddef>
+#include <cstring>
+
+namespace RewardCore
+{
+	void FTrafficLogWriter::WriteFileHeader()
+	{
+		FByteWriter(Buffer).Write(FTrafficLogHeader());
+	}
+
+	size_t FTrafficLogWriter::BeginRecord(const FTrafficRecordHeader& InHeader, const ETrafficRecord InType)
+	{
+		FTrafficRecordHeader Header = InHeader;
+		Header.Type = static_cast<uint16>(InType);
+		Header.PayloadSize = 0;
+
+		const size_t HeaderOffset = Buffer.size();
+		FByteWriter(Buffer).Write(Header);
+		return HeaderOffset;
+	}
+
+	void FTrafficLogWriter::EndRecord(const size_t InHeaderOffset)
+	{
+		const uint32 PayloadSize = static_cast<uint32>(Buffer.size() - InHeaderOffset - sizeof(FTrafficRecordHeader));
+		std::memcpy(Buffer.data() + InHeaderOffset + offsetof(FTrafficRecordHeader, PayloadSize), &PayloadSize, sizeof(PayloadSize));
+	}
+
+	void FTrafficLogWriter::WriteDataImage(const FTrafficRecordHeader& InHeader, const IRewardData& InData)
+	{
+		const size_t HeaderOffset = BeginRecord(InHeader, ETrafficRecord::DataImage);
+
+		FRewardDataImage Image;
+		Image.Capture(InData);
+		Image.Serialize(Buffer);
+
+		EndRecord(HeaderOffset);
+	}
+
+	void FTrafficLogWriter::WriteGacha(const FTrafficRecordHeader& InHeader, const FGachaTraffic& InTraffic)
+	{
+		const size_t HeaderOffset = BeginRecord(InHeader, ETrafficRecord::Gacha);
+
+		FByteWriter Writer(Buffer);
+		Writer.Write(InTraffic.RewardId);
+		Writer.Write(InTraffic.PullCount);
+		Writer.Write(InTraffic.Config);
+		Writer.Write(InTraffic.PityBefore);
+		Writer.Write(InTraffic.PityAfter);
+		Writer.Write(static_cast<uint8>(InTraffic.bSucceeded));
+		Writer.WriteArray(InTraffic.Rewards);
+
+		EndRecord(HeaderOffset);
+	}
+
+	void FTrafficLogWriter::WriteExpand(const FTrafficRecordHeader& InHeader, const FExpandTraffic& InTraffic)
+	{
+		const size_t HeaderOffset = BeginRecord(InHeader, ETrafficRecord::Expand);
+
+		FByteWriter Writer(Buffer);
+		Writer.Write(InTraffic.RewardId);
+		Writer.WriteArray(InTraffic.Rewards);
+
+		EndRecord(HeaderOffset);
+	}
+
+	void FTrafficLogWriter::WriteSimulate(const FTrafficRecordHeader& InHeader, const FSimulateTraffic& InTraffic)
+	{
+		const size_t HeaderOffset = BeginRecord(InHeader, ETrafficRecord::Simulate);
+
+		FByteWriter Writer(Buffer);
+		Writer.Write(InTraffic.AcquireSource);
+		Writer.Write(InTraffic.Outcome);
+		Writer.Write(InTraffic.SlotCount);
+		Writer.Write(InTraffic.MaxCapacity);
+		Writer.WriteArray(InTraffic.Items);
+		Writer.WriteArray(InTraffic.Amounts);
+		Writer.WriteArray(InTraffic.Merged);
+
+		EndRecord(HeaderOffset);
+	}
+
+	void FTrafficLogWriter::WriteInventory(const FTrafficRecordHeader& InHeader, const FInventoryTraffic& InTraffic)
+	{
+		const size_t HeaderOffset = BeginRecord(InHeader, ETrafficRecord::InventoryChange);
+
+		FByteWriter Writer(Buffer);
+		Writer.Write(InTraffic.ItemId);
+		Writer.Write(InTraffic.Amount);
+		Writer.Write(InTraffic.AmountBefore);
+		Writer.Write(InTraffic.Item);
+
+		EndRecord(HeaderOffset);
+	}
+
+	FTrafficLogReader::FTrafficLogReader(const uint8* InData, const size_t InSize)
+		: Data(InData)
+		, Size(InSize)
+	{
+		FTrafficLogHeader Header;
+		FByteReader Reader(InData, InSize);
+		bValid = Reader.Read(Header) && Header.Magic == FTrafficLogHeader::ExpectedMagic && Header.Version == FTrafficLogHeader::CurrentVersion;
+		Offset = sizeof(FTrafficLogHeader);
+	}
+
+	bool FTrafficLogReader::Next(FTrafficRecordHeader& OutHeader, const uint8*& OutPayload)
+	{
+		if (!bValid || Size - Offset < sizeof(FTrafficRecordHeader))
+		{
+			return false;
+		}
+
+		std::memcpy(&OutHeader, Data + Offset, sizeof(FTrafficRecordHeader));
+		if (Size - Offset - sizeof(FTrafficRecordHeader) < OutHeader.PayloadSize)
+		{
+			// 기록 중단으로 잘린 마지막 레코드
+			bValid = false;
+			return false;
+		}
+
+		OutPayload = Data + Offset + sizeof(FTrafficRecordHeader);
+		Offset += sizeof(FTrafficRecordHeader) + OutHeader.PayloadSize;
+		return true;
+	}
+
+	bool FTrafficLogReader::ReadGacha(const uint8* InPayload, const uint32 InSize, FGachaTraffic& OutTraffic)
+	{
+		FByteReader Reader(InPayload, InSize);
+		uint8 bSucceeded = 0;
+		Reader.Read(OutTraffic.RewardId);
+		Reader.Read(OutTraffic.PullCount);
+		Reader.Read(OutTraffic.Config);
+		Reader.Read(OutTraffic.PityBefore);
+		Reader.Read(OutTraffic.PityAfter);
+		Reader.Read(bSucceeded);
+		Reader.ReadArray(OutTraffic.Rewards);
+		OutTraffic.bSucceeded = bSucceeded != 0;
+		return Reader.IsValid();
+	}
+
+	bool FTrafficLogReader::ReadExpand(const uint8* InPayload, const uint32 InSize, FExpandTraffic& OutTraffic)
+	{
+		FByteReader Reader(InPayload, InSize);
+		Reader.Read(OutTraffic.RewardId);
+		Reader.ReadArray(OutTraffic.Rewards);
+		return Reader.IsValid();
+	}
+
+	bool FTrafficLogReader::ReadSimulate(const uint8* InPayload, const uint32 InSize, FSimulateTraffic& OutTraffic)
+	{
+		FByteReader Reader(InPayload, InSize);
+		Reader.Read(OutTraffic.AcquireSource);
+		Reader.Read(OutTraffic.Outcome);
+		Reader.Read(OutTraffic.SlotCount);
+		Reader.Read(OutTraffic.MaxCapacity);
+		Reader.ReadArray(OutTraffic.Items);
+		Reader.ReadArray(OutTraffic.Amounts);
+		Reader.ReadArray(OutTraffic.Merged);
+		return Reader.IsValid();
+	}
+
+	bool FTrafficLogReader::ReadInventory(const uint8* InPayload, const uint32 InSize, FInventoryTraffic& OutTraffic)
+	{
+		FByteReader Reader(InPayload, InSize);
+		Reader.Read(OutTraffic.ItemId);
+		Reader.Read(OutTraffic.Amount);
+		Reader.Read(OutTraffic.AmountBefore);
+		Reader.Read(OutTraffic.Item);
+		return Reader.IsValid();
+	}
+}
@@ -0,0 +1,69 @@
+/**
+ * RewardCore - Weighted Sampler Implementation
+ *
+ * 기술 하이라이트:
+ * - 누적 가중치 배열 + 이진 탐색 (선형 누적 합산 제거)
+ * - PickupGroup 내림차순 정렬로 "N 이상" 후보 집합을 접두 구간으로 표현
+ */
+
+#include "RewardCore/WeightedSampler.h"
+#include <algorithm>
+#include <functional>
+
+namespace RewardCore
+{
+	/**
+	 * 예시 (가중치 70, 25, 5):
+	 * - CumulativeWeights = [70, 95, 100]
+	 * - 난수 96 → 첫 번째로 96 이상인 인덱스 2 선택
+	 */
+	void FWeightedSampler::AddEntry(const FPackedReward& InReward, const int32 InWeight, const int32 InPickupGroup/* = 0*/)
+	{
+		const int64 PrevWeight = CumulativeWeights.empty() ? 0 : CumulativeWeights.back();
+
+		FEntry& Entry = Entries.emplace_back();
+		Entry.Reward = InReward;
+		Entry.PickupGroup = InPickupGroup;
+		CumulativeWeights.emplace_back(PrevWeight + InWeight);
+	}
+
+	void FWeightedSampler::Compile()
+	{
+		PickupCandidates.clear();
+		PickupCandidates.reserve(Entries.size());
+		for (int32 Index = 0; Index < Num(); ++Index)
+		{
+			PickupCandidates.emplace_back(Index);
+		}
+
+		std::stable_sort(PickupCandidates.begin(), PickupCandidates.end(), [this](const int32 A, const int32 B)
+		{
+			return Entries[A].PickupGroup > Entries[B].PickupGroup;
+		});
+
+		PickupGroups.clear();
+		PickupGroups.reserve(PickupCandidates.size());
+		for (const int32 Index : PickupCandidates)
+		{
+			PickupGroups.emplace_back(Entries[Index].PickupGroup);
+		}
+	}
+
+	const FWeightedSampler::FEntry* FWeightedSampler::Roll(const int32 InRandomNumber) const
+	{
+		const auto It = std::lower_bound(CumulativeWeights.begin(), CumulativeWeights.end(), static_cast<int64>(InRandomNumber));
+		return It != CumulativeWeights.end() ? &Entries[It - CumulativeWeights.begin()] : nullptr;
+	}
+
+	int32 FWeightedSampler::GetPickupCandidateNum(const int32 InMinPickupGroup) const
+	{
+		// 내림차순 배열에서 InMinPickupGroup 미만이 처음 나오는 위치 = 후보 수
+		const auto It = std::upper_bound(PickupGroups.begin(), PickupGroups.end(), InMinPickupGroup, std::greater<>());
+		return static_cast<int32>(It - PickupGroups.begin());
+	}
+
+	const FWeightedSampler::FEntry* FWeightedSampler::GetPickupCandidate(const int32 InIndex) const
+	{
+		return InIndex >= 0 && InIndex < static_cast<int32>(PickupCandidates.size()) ? &Entries[PickupCandidates[InIndex]] : nullptr;
+	}
+}
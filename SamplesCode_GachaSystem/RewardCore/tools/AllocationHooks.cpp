@@ -0,0 +1,91 @@
+/**
+ * RewardCore Tools - Allocation Hooks
+ *
+ * 전역 operator new/delete 교체 → RewardCore 할당 카운터 (현재 스레드 태그 기준)
+ * - 블록 앞 16바이트 헤더에 크기/태그/원본 오프셋 기록 (해제 시 할당 태그로 차감)
+ * - 실행 파일 소스에 직접 포함 (정적 라이브러리에 두면 링크 순서에 따라 빠질 수 있음)
+ */
+
+#include "RewardCore/AllocationStats.h"
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+	using namespace RewardCore;
+
+	struct FAllocHeader
+	{
+		uint64 Size;
+		uint32 Offset;		// 원본 블록 시작 ~ 사용자 포인터
+		uint8 Tag;
+		uint8 Padding[3];
+	};
+
+	static_assert(sizeof(FAllocHeader) == 16, "FAllocHeader must keep 16-byte alignment");
+
+	void* Allocate(const size_t InSize, const size_t InAlignment)
+	{
+		const size_t Alignment = InAlignment > sizeof(FAllocHeader) ? InAlignment : sizeof(FAllocHeader);
+		const size_t Offset = Alignment;
+
+		void* Base = Alignment > sizeof(FAllocHeader)
+			? std::aligned_alloc(Alignment, (Offset + InSize + Alignment - 1) / Alignment * Alignment)
+			: std::malloc(Offset + InSize);
+		if (!Base)
+		{
+			return nullptr;
+		}
+
+		uint8* User = static_cast<uint8*>(Base) + Offset;
+		FAllocHeader* Header = reinterpret_cast<FAllocHeader*>(User) - 1;
+		Header->Size = InSize;
+		Header->Offset = static_cast<uint32>(Offset);
+		Header->Tag = static_cast<uint8>(GetAllocTag());
+
+		RecordAlloc(static_cast<EAllocTag>(Header->Tag), InSize);
+		return User;
+	}
+
+	void* AllocateOrThrow(const size_t InSize, const size_t InAlignment)
+	{
+		if (void* Pointer = Allocate(InSize, InAlignment))
+		{
+			return Pointer;
+		}
+		throw std::bad_alloc();
+	}
+
+	void Free(void* InPointer)
+	{
+		if (!InPointer)
+		{
+			return;
+		}
+
+		const FAllocHeader* Header = static_cast<FAllocHeader*>(InPointer) - 1;
+		RecordFree(static_cast<EAllocTag>(Header->Tag), Header->Size);
+		std::free(static_cast<uint8*>(InPointer) - Header->Offset);
+	}
+
+	struct FActivate
+	{
+		FActivate() { SetAllocTrackingActive(); }
+	} Activate;
+}
+
+void* operator new(size_t InSize) { return AllocateOrThrow(InSize, 0); }
+void* operator new[](size_t InSize) { return AllocateOrThrow(InSize, 0); }
+void* operator new(size_t InSize, const std::nothrow_t&) noexcept { return Allocate(InSize, 0); }
+void* operator new[](size_t InSize, const std::nothrow_t&) noexcept { return Allocate(InSize, 0); }
+void* operator new(size_t InSize, std::align_val_t InAlignment) { return AllocateOrThrow(InSize, static_cast<size_t>(InAlignment)); }
+void* operator new[](size_t InSize, std::align_val_t InAlignment) { return AllocateOrThrow(InSize, static_cast<size_t>(InAlignment)); }
+
+void operator delete(void* InPointer) noexcept { Free(InPointer); }
+void operator delete[](void* InPointer) noexcept { Free(InPointer); }
+void operator delete(void* InPointer, size_t) noexcept { Free(InPointer); }
+void operator delete[](void* InPointer, size_t) noexcept { Free(InPointer); }
+void operator delete(void* InPointer, std::align_val_t) noexcept { Free(InPointer); }
+void operator delete[](void* InPointer, std::align_val_t) noexcept { Free(InPointer); }
+void operator delete(void* InPointer, size_t, std::align_val_t) noexcept { Free(InPointer); }
+void operator delete[](void* InPointer, size_t, std::align_val_t) noexcept { Free(InPointer); }
@@ -0,0 +1,245 @@
+/**
+ * RewardCore Tools - Bench Harness Implementation
+ */
+
+#include "BenchHarness.h"
+#include "RewardCore/AllocationStats.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace RewardTools
+{
+	namespace
+	{
+		double MeasureNs(const FBenchFunction& InFunction, const uint64 InIterations)
+		{
+			const auto Begin = std::chrono::steady_clock::now();
+			InFunction(InIterations);
+			const auto End = std::chrono::steady_clock::now();
+			return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(End - Begin).count());
+		}
+
+		std::string EscapeJson(const std::string& InText)
+		{
+			std::string Escaped;
+			Escaped.reserve(InText.size());
+			for (const char Char : InText)
+			{
+				if (Char == '"' || Char == '\\')
+				{
+					Escaped.push_back('\\');
+				}
+				Escaped.push_back(Char);
+			}
+			return Escaped;
+		}
+
+		/**
+		 * "Key": 다음 값 위치 (InFrom 이후, 없으면 npos)
+		 */
+		size_t FindValue(const std::string& InText, const char* InKey, const size_t InFrom, const size_t InTo)
+		{
+			const std::string Pattern = std::string("\"") + InKey + "\"";
+			const size_t KeyPos = InText.find(Pattern, InFrom);
+			if (KeyPos == std::string::npos || KeyPos >= InTo)
+			{
+				return std::string::npos;
+			}
+
+			const size_t Colon = InText.find(':', KeyPos + Pattern.size());
+			return Colon == std::string::npos ? Colon : InText.find_first_not_of(" \t\r\n", Colon + 1);
+		}
+	}
+
+	/**
+	 * 측정 순서:
+	 * 1. 1회부터 2배씩 늘려 샘플 1회가 MinSampleMs 이상 걸리는 반복 횟수 결정
+	 * 2. 같은 횟수로 Samples 회 측정
+	 * 3. 중앙값/최소값 기록, 할당 수는 전체 샘플 평균 (결정적이라 샘플 간 차이 없음)
+	 */
+	void FBenchRunner::Run(const std::string& InName, const FBenchFunction& InFunction)
+	{
+		if (!Options.Filter.empty() && InName.find(Options.Filter) == std::string::npos)
+		{
+			return;
+		}
+
+		const double MinSampleNs = Options.MinSampleMs * 1.0e6;
+
+		uint64 Iterations = 1;
+		for (;;)
+		{
+			const double ElapsedNs = MeasureNs(InFunction, Iterations);
+			if (ElapsedNs >= MinSampleNs || Iterations >= (1ull << 40))
+			{
+				break;
+			}
+
+			// 목표 시간에 맞게 한 번에 키우되 최대 10배
+			const double Scale = ElapsedNs > 0.0 ? MinSampleNs / ElapsedNs * 1.2 : 10.0;
+			Iterations = std::max<uint64>(Iterations + 1, static_cast<uint64>(Iterations * std::min(Scale, 10.0)));
+		}
+
+		std::vector<double> NsPerOp;
+		NsPerOp.reserve(std::max(Options.Samples, 1));
+
+		const FAllocStats AllocsBefore = GetTotalAllocStats();
+		for (int32 Sample = 0; Sample < std::max(Options.Samples, 1); ++Sample)
+		{
+			NsPerOp.emplace_back(MeasureNs(InFunction, Iterations) / static_cast<double>(Iterations));
+		}
+		const FAllocStats AllocsAfter = GetTotalAllocStats();
+		std::sort(NsPerOp.begin(), NsPerOp.end());
+
+		FBenchResult& Result = Results.emplace_back();
+		Result.Name = InName;
+		Result.Iterations = Iterations;
+		Result.NsPerOp = NsPerOp[NsPerOp.size() / 2];
+		Result.MinNsPerOp = NsPerOp.front();
+
+		if (IsAllocTrackingActive())
+		{
+			const double TotalOps = static_cast<double>(Iterations) * static_cast<double>(NsPerOp.size());
+			Result.AllocsPerOp = static_cast<double>(AllocsAfter.Count - AllocsBefore.Count) / TotalOps;
+			Result.BytesPerOp = static_cast<double>(AllocsAfter.TotalBytes - AllocsBefore.TotalBytes) / TotalOps;
+
+			std::printf("%-40s %12.1f ns/op  %8.2f allocs/op %10.1f B/op  (min %.1f, %llu iters)\n", InName.c_str(), Result.NsPerOp, Result.AllocsPerOp, Result.BytesPerOp, Result.MinNsPerOp, static_cast<unsigned long long>(Iterations));
+		}
+		else
+		{
+			std::printf("%-40s %12.1f ns/op  (min %.1f, %llu iters)\n", InName.c_str(), Result.NsPerOp, Result.MinNsPerOp, static_cast<unsigned long long>(Iterations));
+		}
+		std::fflush(stdout);
+	}
+
+	bool WriteResults(const std::string& InPath, const std::vector<FBenchResult>& InResults)
+	{
+		std::ofstream File(InPath, std::ios::binary | std::ios::trunc);
+		if (!File)
+		{
+			return false;
+		}
+
+		File << "{\n\t\"schema\": \"reward-bench/1\",\n\t\"results\": [\n";
+		for (size_t Index = 0; Index < InResults.size(); ++Index)
+		{
+			const FBenchResult& Result = InResults[Index];
+			File << "\t\t{ \"name\": \"" << EscapeJson(Result.Name)
+				<< "\", \"iterations\": " << Result.Iterations
+				<< ", \"ns_per_op\": " << Result.NsPerOp
+				<< ", \"min_ns_per_op\": " << Result.MinNsPerOp;
+			if (Result.AllocsPerOp >= 0.0)
+			{
+				File << ", \"allocs_per_op\": " << Result.AllocsPerOp
+					<< ", \"bytes_per_op\": " << Result.BytesPerOp;
+			}
+			File << " }" << (Index + 1 < InResults.size() ? ",\n" : "\n");
+		}
+		File << "\t]\n}\n";
+		return static_cast<bool>(File);
+	}
+
+	/**
+	 * 자체 스키마만 읽는 최소 파서 (결과 객체별 name / iterations / ns_per_op / min_ns_per_op / allocs_per_op / bytes_per_op)
+	 */
+	bool ReadResults(const std::string& InPath, std::vector<FBenchResult>& OutResults)
+	{
+		std::ifstream File(InPath, std::ios::binary);
+		if (!File)
+		{
+			return false;
+		}
+
+		std::stringstream Buffer;
+		Buffer << File.rdbuf();
+		const std::string Text = Buffer.str();
+
+		const size_t ResultsPos = Text.find("\"results\"");
+		if (ResultsPos == std::string::npos)
+		{
+			return false;
+		}
+
+		size_t Cursor = ResultsPos;
+		for (;;)
+		{
+			const size_t ObjectBegin = Text.find('{', Cursor);
+			if (ObjectBegin == std::string::npos)
+			{
+				break;
+			}
+			const size_t ObjectEnd = Text.find('}', ObjectBegin);
+			if (ObjectEnd == std::string::npos)
+			{
+				return false;
+			}
+
+			const size_t NamePos = FindValue(Text, "name", ObjectBegin, ObjectEnd);
+			const size_t NsPos = FindValue(Text, "ns_per_op", ObjectBegin, ObjectEnd);
+			if (NamePos != std::string::npos && NsPos != std::string::npos && Text[NamePos] == '"')
+			{
+				FBenchResult& Result = OutResults.emplace_back();
+				Result.Name = Text.substr(NamePos + 1, Text.find('"', NamePos + 1) - NamePos - 1);
+				Result.NsPerOp = std::strtod(Text.c_str() + NsPos, nullptr);
+
+				if (const size_t IterPos = FindValue(Text, "iterations", ObjectBegin, ObjectEnd); IterPos != std::string::npos)
+				{
+					Result.Iterations = std::strtoull(Text.c_str() + IterPos, nullptr, 10);
+				}
+				if (const size_t MinPos = FindValue(Text, "min_ns_per_op", ObjectBegin, ObjectEnd); MinPos != std::string::npos)
+				{
+					Result.MinNsPerOp = std::strtod(Text.c_str() + MinPos, nullptr);
+				}
+				if (const size_t AllocsPos = FindValue(Text, "allocs_per_op", ObjectBegin, ObjectEnd); AllocsPos != std::string::npos)
+				{
+					Result.AllocsPerOp = std::strtod(Text.c_str() + AllocsPos, nullptr);
+				}
+				if (const size_t BytesPos = FindValue(Text, "bytes_per_op", ObjectBegin, ObjectEnd); BytesPos != std::string::npos)
+				{
+					Result.BytesPerOp = std::strtod(Text.c_str() + BytesPos, nullptr);
+				}
+			}
+
+			Cursor = ObjectEnd + 1;
+		}
+		return true;
+	}
+
+	int32 CompareResults(const std::vector<FBenchResult>& InBaseline, const std::vector<FBenchResult>& InCurrent, const double InThresholdPercent)
+	{
+		int32 RegressionNum = 0;
+
+		std::printf("%-40s %12s %12s %9s\n", "name", "baseline", "current", "delta");
+		for (const FBenchResult& Current : InCurrent)
+		{
+			const auto Baseline = std::find_if(InBaseline.begin(), InBaseline.end(), [&Current](const FBenchResult& Result) { return Result.Name == Current.Name; });
+			if (Baseline == InBaseline.end() || Baseline->NsPerOp <= 0.0)
+			{
+				std::printf("%-40s %12s %12.1f %9s\n", Current.Name.c_str(), "-", Current.NsPerOp, "new");
+				continue;
+			}
+
+			const double DeltaPercent = (Current.NsPerOp - Baseline->NsPerOp) / Baseline->NsPerOp * 100.0;
+			const bool bRegressed = DeltaPercent > InThresholdPercent;
+
+			// 할당 수는 타이밍 노이즈가 없으므로 반올림 오차 이상 증가하면 회귀
+			const bool bAllocsMeasured = Baseline->AllocsPerOp >= 0.0 && Current.AllocsPerOp >= 0.0;
+			const bool bAllocsRegressed = bAllocsMeasured && Current.AllocsPerOp > Baseline->AllocsPerOp + 0.01;
+			RegressionNum += (bRegressed || bAllocsRegressed) ? 1 : 0;
+
+			std::printf("%-40s %12.1f %12.1f %+8.1f%%%s", Current.Name.c_str(), Baseline->NsPerOp, Current.NsPerOp, DeltaPercent, bRegressed ? "  REGRESSION" : "");
+			if (bAllocsMeasured)
+			{
+				std::printf("  allocs/op %.2f -> %.2f%s", Baseline->AllocsPerOp, Current.AllocsPerOp, bAllocsRegressed ? "  ALLOC REGRESSION" : "");
+			}
+			std::printf("\n");
+		}
+
+		std::printf("%d regression(s) over %.1f%% or with more allocs/op\n", RegressionNum, InThresholdPercent);
+		return RegressionNum;
+	}
+}
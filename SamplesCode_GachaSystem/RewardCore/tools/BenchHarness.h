@@ -0,0 +1,91 @@
+/**
+ * RewardCore Tools - Bench Harness
+ *
+ * 주요 기능:
+ * - 케이스별 반복 횟수 자동 보정 (최소 측정 시간 기준)
+ * - 반복 측정 중앙값/최소값 (ns/op)
+ * - 할당 횟수/바이트 (allocs/op, bytes/op, AllocationHooks.cpp 링크 시)
+ * - JSON 출력 및 기준 결과 대비 회귀 비교
+ *
+ * JSON 스키마 (UE 측 벤치 명령도 같은 형식 사용, 할당 항목은 선택):
+ * { "schema": "reward-bench/1", "results": [ { "name": ..., "iterations": ..., "ns_per_op": ..., "min_ns_per_op": ..., "allocs_per_op": ..., "bytes_per_op": ... } ] }
+ */
+
+#pragma once
+
+#include "RewardCore/RewardTypes.h"
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace RewardTools
+{
+	using namespace RewardCore;
+
+	/**
+	 * 최적화로 제거되지 않도록 값 소비
+	 */
+	template <typename T>
+	inline void DoNotOptimize(const T& InValue)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(InValue) : "memory");
+#else
+		static volatile const T* Sink;
+		Sink = &InValue;
+#endif
+	}
+
+	struct FBenchResult
+	{
+		std::string Name;
+		uint64 Iterations = 0;
+		double NsPerOp = 0.0;
+		double MinNsPerOp = 0.0;
+
+		// 음수면 측정 안 됨 (할당 훅 없음)
+		double AllocsPerOp = -1.0;
+		double BytesPerOp = -1.0;
+	};
+
+	/**
+	 * 벤치 케이스 : InIterations 회 실행
+	 */
+	using FBenchFunction = std::function<void(uint64 InIterations)>;
+
+	class FBenchRunner
+	{
+	public:
+		struct FOptions
+		{
+			// 이름에 포함된 케이스만 실행 (비어 있으면 전체)
+			std::string Filter;
+
+			// 샘플 1회 최소 측정 시간
+			double MinSampleMs = 50.0;
+
+			// 샘플 수 (중앙값 사용)
+			int32 Samples = 5;
+		};
+
+		explicit FBenchRunner(const FOptions& InOptions) : Options(InOptions) {}
+
+		void Run(const std::string& InName, const FBenchFunction& InFunction);
+
+		const std::vector<FBenchResult>& GetResults() const { return Results; }
+
+	private:
+		FOptions Options;
+		std::vector<FBenchResult> Results;
+	};
+
+	bool WriteResults(const std::string& InPath, const std::vector<FBenchResult>& InResults);
+	bool ReadResults(const std::string& InPath, std::vector<FBenchResult>& OutResults);
+
+	/**
+	 * 기준 대비 비교 결과 출력
+	 * @param InThresholdPercent ns/op 증가율이 이 값을 넘으면 회귀 (allocs/op는 증가 자체가 회귀)
+	 * @return 회귀 케이스 수
+	 */
+	int32 CompareResults(const std::vector<FBenchResult>& InBaseline, const std::vector<FBenchResult>& InCurrent, const double InThresholdPercent);
+}
@@ -0,0 +1,342 @@
+/**
+ * RewardCore Tools - Reward Bench
+ *
+ * 보상/인벤토리 핫 패스 마이크로벤치마크
+ * - RollReward (UServerRewardSystem RollRandomReward 대응) : 후보 10 ~ 10k
+ * - PickupReward (AddPickupReward 대응)
+ * - PullGacha 1회/10회 (OnPostGive_Gacha 대응, 피티 저장소 포함)
+ * - ExpandReward (BuildRewardData 대응) : 깊은 보상 트리
+ * - MergeItemRewards + FSlotSimulator (SimulateRewards 대응) : 보상 10 ~ 10k, 대형 인벤토리
+ * - 뽑기 → 병합 → 슬롯 판정 트랜잭션 1회/10회 : 매번 새 배열 (힙 / 트랜잭션 아레나 비교)
+ *   ledger는 아레나 + 예약 원장 판정/예약/해제 포함 (동시 지급 대비 추가 비용)
+ * - 케이스별 allocs/op, bytes/op 및 종료 시 태그별 할당 합계 (AllocationHooks.cpp)
+ *
+ * 자막 파싱(USubtitle::Parse / ParseTimeToTimespan)은 엔진 코드이므로
+ * UE 측 VideoPlayer.BenchSubtitle 콘솔 명령이 같은 JSON 형식으로 출력 (--compare로 함께 비교)
+ *
+ * 사용법:
+ *   RewardBench [--out=<결과.json>] [--filter=<이름 일부>] [--min-time-ms=50] [--samples=5]
+ *   RewardBench --compare=<기준.json> <현재.json> [--threshold=10]
+ *   (회귀가 있으면 종료 코드 1)
+ */
+
+#include "BenchHarness.h"
+#include "SyntheticRewardData.h"
+#include "RewardCore/AllocationStats.h"
+#include "RewardCore/DefaultRandom.h"
+#include "RewardCore/GachaRoller.h"
+#include "RewardCore/InventoryLedger.h"
+#include "RewardCore/RewardExpander.h"
+#include "RewardCore/SlotSimulator.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+using namespace RewardTools;
+
+namespace
+{
+	struct FConfig
+	{
+		FBenchRunner::FOptions Options;
+		const char* OutPath = nullptr;
+		const char* BaselinePath = nullptr;
+		const char* CurrentPath = nullptr;
+		double Threshold = 10.0;
+	};
+
+	int PrintUsage()
+	{
+		std::fprintf(stderr, "usage: RewardBench [--out=<result.json>] [--filter=<name>] [--min-time-ms=50] [--samples=5]\n");
+		std::fprintf(stderr, "       RewardBench --compare=<baseline.json> <current.json> [--threshold=10]\n");
+		return 2;
+	}
+
+	int RunCompare(const FConfig& InConfig)
+	{
+		if (!InConfig.CurrentPath)
+		{
+			return PrintUsage();
+		}
+
+		std::vector<FBenchResult> Baseline;
+		std::vector<FBenchResult> Current;
+		if (!ReadResults(InConfig.BaselinePath, Baseline) || !ReadResults(InConfig.CurrentPath, Current))
+		{
+			std::fprintf(stderr, "failed to read %s or %s\n", InConfig.BaselinePath, InConfig.CurrentPath);
+			return 2;
+		}
+
+		return CompareResults(Baseline, Current, InConfig.Threshold) > 0 ? 1 : 0;
+	}
+
+	void RunSamplerBenches(FBenchRunner& InRunner)
+	{
+		for (const int32 EntryNum : { 10, 100, 1000, 10000 })
+		{
+			FSyntheticRewardData Data;
+			Data.AddItems(1024);
+			const FRewardDefinition& Reward = *Data.GetRewardDefinition(Data.AddGachaReward(EntryNum, EntryNum));
+
+			FDefaultRandom Random(1);
+			InRunner.Run("RollReward/" + std::to_string(EntryNum), [&](const uint64 InIterations)
+			{
+				for (uint64 Index = 0; Index < InIterations; ++Index)
+				{
+					int32 PickupGroup = 0;
+					const FPackedReward Result = RollReward(Reward.Gacha, Reward.TotalGachaWeight, Random, PickupGroup);
+					DoNotOptimize(Result);
+				}
+			});
+
+			InRunner.Run("PickupReward/" + std::to_string(EntryNum), [&](const uint64 InIterations)
+			{
+				for (uint64 Index = 0; Index < InIterations; ++Index)
+				{
+					const FPackedReward Result = PickupReward(Reward.Gacha, 1, Random);
+					DoNotOptimize(Result);
+				}
+			});
+		}
+	}
+
+	void RunGachaBenches(FBenchRunner& InRunner)
+	{
+		FSyntheticRewardData Data;
+		Data.AddItems(1024);
+		const FRowId RewardId = Data.AddGachaReward(200, 42);
+
+		FPityConfig Config;
+		Config.NormalPickupGroup = 1;
+		Config.SpecialPickupGroup = 2;
+		Config.SpecialTryCount = 90;
+
+		for (const int32 PullCount : { 1, 10 })
+		{
+			FMemoryPityStore PityStore;
+			FDefaultRandom Random(7);
+			FPackedRewardArray Rewards;
+
+			InRunner.Run("PullGacha/" + std::to_string(PullCount), [&](const uint64 InIterations)
+			{
+				for (uint64 Index = 0; Index < InIterations; ++Index)
+				{
+					Rewards.clear();
+					PullGacha(Data, PityStore, Random, RewardId, Config, PullCount, Rewards);
+					DoNotOptimize(Rewards.data());
+				}
+			});
+		}
+	}
+
+	void RunExpandBenches(FBenchRunner& InRunner)
+	{
+		for (const int32 Depth : { 4, 8, 12 })
+		{
+			FSyntheticRewardData Data;
+			Data.AddItems(1024);
+			const FRowId RootId = Data.AddRewardTree(Depth, 2);
+
+			FDefaultRandom Random(3);
+			FPackedRewardArray Rewards;
+
+			InRunner.Run("ExpandReward/depth" + std::to_string(Depth), [&](const uint64 InIterations)
+			{
+				for (uint64 Index = 0; Index < InIterations; ++Index)
+				{
+					Rewards.clear();
+					ExpandReward(Data, RootId, Random, Rewards);
+					DoNotOptimize(Rewards.data());
+				}
+			});
+		}
+	}
+
+	/**
+	 * 아이템 10k종, 1/2 보유 인벤토리에 보상 N개 병합 + 슬롯 예측
+	 */
+	void RunSimulateBenches(FBenchRunner& InRunner)
+	{
+		constexpr int32 ItemNum = 10000;
+
+		FSyntheticRewardData Data;
+		Data.AddItems(ItemNum);
+
+		FMemoryInventory Inventory(ItemNum, 1 << 30);
+		Inventory.Fill(Data, 2, 5);
+
+		for (const int32 RewardNum : { 10, 100, 1000, 10000 })
+		{
+			FDefaultRandom Random(RewardNum);
+
+			std::vector<FPackedReward> Items;
+			Items.reserve(RewardNum);
+			for (int32 Index = 0; Index < RewardNum; ++Index)
+			{
+				Items.emplace_back(Data.MakeItemReward(static_cast<FRowId>(Random.RandRange(0, ItemNum - 1)), Random.RandRange(1, 3)));
+			}
+
+			FPackedRewardArray Merged;
+			InRunner.Run("SimulateRewards/" + std::to_string(RewardNum), [&](const uint64 InIterations)
+			{
+				for (uint64 Index = 0; Index < InIterations; ++Index)
+				{
+					Merged.clear();
+					MergeItemRewards(Data, Items.data(), Items.size(), 0, Merged);
+
+					FSlotSimulator Slots(Inventory);
+					const bool bFits = Slots.AddRewards(Data, Merged.data(), Merged.size());
+					DoNotOptimize(bFits);
+				}
+			});
+		}
+	}
+
+	/**
+	 * OnPostGive_Gacha + SimulateRewards 한 트랜잭션 (배열 재사용 없이 매번 생성)
+	 * arena는 FRewardArenaScope 안에서 실행 → 블록 재사용으로 allocs/op ~0
+	 */
+	void RunTransactionBenches(FBenchRunner& InRunner)
+	{
+		FSyntheticRewardData Data;
+		Data.AddItems(1024);
+		const FRowId RewardId = Data.AddGachaReward(200, 42);
+
+		FPityConfig Config;
+		Config.NormalPickupGroup = 1;
+		Config.SpecialPickupGroup = 2;
+		Config.SpecialTryCount = 90;
+
+		FMemoryInventory Inventory(1024, 1 << 30);
+		Inventory.Fill(Data, 2, 5);
+
+		for (const int32 PullCount : { 1, 10 })
+		{
+			FMemoryPityStore PityStore;
+			FDefaultRandom Random(11);
+
+			auto RunTransaction = [&](const TRewardArenaAllocator<FPackedReward>& InAllocator)
+			{
+				FPackedRewardArray Rewards(InAllocator);
+				PullGacha(Data, PityStore, Random, RewardId, Config, PullCount, Rewards);
+
+				FPackedRewardArray Merged(InAllocator);
+				MergeItemRewards(Data, Rewards.data(), Rewards.size(), 0, Merged);
+
+				FSlotSimulator Slots(Inventory);
+				const bool bFits = Slots.AddRewards(Data, Merged.data(), Merged.size());
+				DoNotOptimize(bFits);
+			};
+
+			InRunner.Run("GrantTransaction/heap/" + std::to_string(PullCount), [&](const uint64 InIterations)
+			{
+				for (uint64 Index = 0; Index < InIterations; ++Index)
+				{
+					RunTransaction(TRewardArenaAllocator<FPackedReward>());
+				}
+			});
+
+			InRunner.Run("GrantTransaction/arena/" + std::to_string(PullCount), [&](const uint64 InIterations)
+			{
+				for (uint64 Index = 0; Index < InIterations; ++Index)
+				{
+					const FRewardArenaScope ArenaScope;
+					RunTransaction(ArenaScope.GetArena());
+				}
+			});
+
+			FInventoryLedger Ledger;
+			InRunner.Run("GrantTransaction/ledger/" + std::to_string(PullCount), [&](const uint64 InIterations)
+			{
+				for (uint64 Index = 0; Index < InIterations; ++Index)
+				{
+					const FRewardArenaScope ArenaScope;
+
+					FPackedRewardArray Rewards(ArenaScope.GetArena());
+					PullGacha(Data, PityStore, Random, RewardId, Config, PullCount, Rewards);
+
+					FPackedRewardArray Merged(ArenaScope.GetArena());
+					MergeItemRewards(Data, Rewards.data(), Rewards.size(), 0, Merged);
+
+					FReservationId ReservationId = InvalidReservationId;
+					{
+						FInventoryLedger::FLedgerView LedgerView(Ledger, Index % 8, Inventory);
+						FSlotSimulator Slots(LedgerView);
+						if (Slots.AddRewards(Data, Merged.data(), Merged.size()))
+						{
+							ReservationId = LedgerView.Reserve(Data, Merged.data(), Merged.size());
+						}
+					}
+					Ledger.Commit(ReservationId);
+					DoNotOptimize(ReservationId);
+				}
+			});
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	FConfig Config;
+	for (int Index = 1; Index < argc; ++Index)
+	{
+		const char* Arg = argv[Index];
+		auto Match = [Arg](const char* InName) -> const char*
+		{
+			const size_t Length = std::strlen(InName);
+			return std::strncmp(Arg, InName, Length) == 0 ? Arg + Length : nullptr;
+		};
+
+		if (const char* Value = Match("--out="))					{ Config.OutPath = Value; }
+		else if (const char* Value = Match("--filter="))		{ Config.Options.Filter = Value; }
+		else if (const char* Value = Match("--min-time-ms="))	{ Config.Options.MinSampleMs = std::atof(Value); }
+		else if (const char* Value = Match("--samples="))		{ Config.Options.Samples = std::atoi(Value); }
+		else if (const char* Value = Match("--compare="))		{ Config.BaselinePath = Value; }
+		else if (const char* Value = Match("--threshold="))		{ Config.Threshold = std::atof(Value); }
+		else if (Arg[0] != '-' && !Config.CurrentPath)			{ Config.CurrentPath = Arg; }
+		else
+		{
+			std::fprintf(stderr, "unknown option %s\n", Arg);
+			return PrintUsage();
+		}
+	}
+
+	if (Config.BaselinePath)
+	{
+		return RunCompare(Config);
+	}
+
+	// 비교 모드 밖의 위치 인자는 허용하지 않음
+	if (Config.CurrentPath)
+	{
+		std::fprintf(stderr, "unknown option %s\n", Config.CurrentPath);
+		return PrintUsage();
+	}
+
+	FBenchRunner Runner(Config.Options);
+	RunSamplerBenches(Runner);
+	RunGachaBenches(Runner);
+	RunExpandBenches(Runner);
+	RunSimulateBenches(Runner);
+	RunTransactionBenches(Runner);
+
+	for (int32 Tag = 0; Tag < static_cast<int32>(EAllocTag::Num); ++Tag)
+	{
+		const FAllocStats Stats = GetAllocStats(static_cast<EAllocTag>(Tag));
+		std::printf("alloc[%-9s] count %llu, bytes %llu, peak %lld\n", GetAllocTagName(static_cast<EAllocTag>(Tag)),
+			static_cast<unsigned long long>(Stats.Count), static_cast<unsigned long long>(Stats.TotalBytes), static_cast<long long>(Stats.PeakBytes));
+	}
+
+	if (Config.OutPath)
+	{
+		if (!WriteResults(Config.OutPath, Runner.GetResults()))
+		{
+			std::fprintf(stderr, "failed to write %s\n", Config.OutPath);
+			return 2;
+		}
+		std::printf("wrote %s\n", Config.OutPath);
+	}
+
+	return 0;
+}
@@ -0,0 +1,487 @@
+/**
+ * RewardCore Tools - Reward Load Generator
+ *
+ * 폐루프(closed-loop) 부하 생성기 : 계정 N개를 스레드 T개가 나눠 맡아
+ * 각 스레드가 이전 요청이 끝나면 다음 요청을 보내는 방식으로 로컬 SQLite 게임 DB에 부하
+ *
+ * 작업 (기본 비율):
+ * - pull1 (40) / pull10 (30) : 티켓(없으면 유료 재화) 소모 → 피티 로드 → 뽑기 → 아이템 지급 → 피티 저장
+ * - exchange (20) : UGachaUI::OnExchangeTicket 대응, 남은 티켓 소진 + 유료 재화 차감 + 티켓 지급
+ * - remove (10) : 보유 장비 최대 5개 제거 (음수 보상으로 지급 파이프라인 경유)
+ *
+ * 출력 : 작업별 처리량, p50/p99/p999 지연, 거절 수 / DB 커밋 수와 초당 커밋
+ * 네트워크 없이 동작 (배너 오픈 전 샤드 크기 산정용)
+ *
+ * 사용법:
+ *   RewardLoadGen [--accounts=1000] [--threads=8] [--duration=10] [--shards=1] [--db=loadgen]
+ *                 [--mix=pull1:40,pull10:30,exchange:20,remove:10] [--seed=1] [--json=<결과.json>]
+ */
+
+#include "SqliteGameDb.h"
+#include "SyntheticRewardData.h"
+#include "RewardCore/DefaultRandom.h"
+#include "RewardCore/GachaRoller.h"
+#include "RewardCore/RewardGrant.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+
+using namespace RewardTools;
+
+namespace
+{
+	enum EOperation
+	{
+		OpPull1,
+		OpPull10,
+		OpExchange,
+		OpRemove,
+		OpNum
+	};
+
+	const char* const OperationNames[OpNum] = { "pull1", "pull10", "exchange", "remove" };
+
+	enum class EOpResult : uint8
+	{
+		Success,
+		Rejected,	// 재화 부족/인벤토리 가득/제거할 장비 없음 (롤백)
+		Failed,		// DB 오류/잠금 대기 초과
+	};
+
+	struct FConfig
+	{
+		int32 AccountNum = 1000;
+		int32 ThreadNum = 8;
+		double DurationSeconds = 10.0;
+		int32 ShardNum = 1;
+		std::string DbPrefix = "loadgen";
+		int32 Mix[OpNum] = { 40, 30, 20, 10 };
+		uint64 Seed = 1;
+		std::string JsonPath;
+
+		// 계정 초기 상태
+		int32 MaxCapacity = 400;
+		int64 InitialCurrency = 1000000000;
+		int32 PullPrice = 160;
+	};
+
+	/**
+	 * 공용 게임 데이터 (읽기 전용, 스레드 공유)
+	 */
+	struct FGameData
+	{
+		FSyntheticRewardData Data;
+		FRowId GachaId = InvalidRowId;
+		FRowId TicketId = InvalidRowId;
+		FPityConfig PityConfig;
+
+		FGameData()
+		{
+			Data.AddItems(2000);
+			GachaId = Data.AddGachaReward(300, 42);
+			TicketId = 1;	// 스택 가능 아이템
+
+			PityConfig.NormalPickupGroup = 1;
+			PityConfig.SpecialPickupGroup = 2;
+			PityConfig.SpecialTryCount = 90;
+		}
+	};
+
+	struct FOpStats
+	{
+		std::vector<uint64> LatencyNs;
+		uint64 Rejected = 0;
+		uint64 Failed = 0;
+	};
+
+	struct FWorker
+	{
+		std::vector<std::unique_ptr<FSqliteGameDb>> Shards;
+		FDefaultRandom Random;
+		FOpStats Stats[OpNum];
+		FPackedRewardArray Rewards;
+		std::vector<FRowId> Equipments;
+	};
+
+	std::string GetShardPath(const FConfig& InConfig, const int32 InShard)
+	{
+		return InConfig.DbPrefix + "_" + std::to_string(InShard) + ".db";
+	}
+
+	bool ParseMix(const char* InText, int32 (&OutMix)[OpNum])
+	{
+		std::fill(std::begin(OutMix), std::end(OutMix), 0);
+
+		std::string Text(InText);
+		size_t Begin = 0;
+		while (Begin < Text.size())
+		{
+			const size_t End = std::min(Text.find(',', Begin), Text.size());
+			const std::string Token = Text.substr(Begin, End - Begin);
+			const size_t Colon = Token.find(':');
+
+			const auto It = std::find_if(std::begin(OperationNames), std::end(OperationNames), [&](const char* Name) { return Token.compare(0, Colon, Name) == 0; });
+			if (Colon == std::string::npos || It == std::end(OperationNames))
+			{
+				return false;
+			}
+
+			OutMix[It - std::begin(OperationNames)] = std::atoi(Token.c_str() + Colon + 1);
+			Begin = End + 1;
+		}
+		return true;
+	}
+
+	/**
+	 * 뽑기 : 티켓 N장(없으면 유료 재화) → 피티 로드/뽑기/저장 → 아이템 지급
+	 */
+	EOpResult RunPull(const FConfig& InConfig, const FGameData& InGame, FSqliteGameDb& InDb, FWorker& InWorker, const int32 InPullCount)
+	{
+		const FItemDefinition& Ticket = *InGame.Data.GetItemDefinition(InGame.TicketId);
+		if (InDb.GetAmount(InGame.TicketId) >= InPullCount)
+		{
+			if (!InDb.ApplyItem(InGame.TicketId, Ticket, -InPullCount))
+			{
+				return EOpResult::Failed;
+			}
+		}
+		else if (InDb.GetCurrency() >= static_cast<int64>(InPullCount) * InConfig.PullPrice)
+		{
+			InDb.AddCurrency(-static_cast<int64>(InPullCount) * InConfig.PullPrice);
+		}
+		else
+		{
+			return EOpResult::Rejected;
+		}
+
+		InWorker.Rewards.clear();
+		if (!PullGacha(InGame.Data, InDb, InWorker.Random, InGame.GachaId, InGame.PityConfig, InPullCount, InWorker.Rewards))
+		{
+			return EOpResult::Failed;
+		}
+
+		switch (GrantItemRewards(InGame.Data, InDb, InWorker.Rewards.data(), InWorker.Rewards.size()))
+		{
+		case EGrantResult::Success:			return EOpResult::Success;
+		case EGrantResult::InventoryFull:	return EOpResult::Rejected;
+		default:							return EOpResult::Failed;
+		}
+	}
+
+	/**
+	 * 티켓 교환 : 남은 티켓 소진 → 유료 재화 차감 → 티켓 10장 지급
+	 */
+	EOpResult RunExchange(const FConfig& InConfig, const FGameData& InGame, FSqliteGameDb& InDb, FWorker& InWorker)
+	{
+		constexpr int32 ExchangeAmount = 10;
+
+		const FItemDefinition& Ticket = *InGame.Data.GetItemDefinition(InGame.TicketId);
+		if (const int32 Remaining = InDb.GetAmount(InGame.TicketId); Remaining > 0)
+		{
+			if (!InDb.ApplyItem(InGame.TicketId, Ticket, -Remaining))
+			{
+				return EOpResult::Failed;
+			}
+		}
+
+		const int64 Price = static_cast<int64>(ExchangeAmount) * InConfig.PullPrice;
+		if (InDb.GetCurrency() < Price)
+		{
+			return EOpResult::Rejected;
+		}
+		InDb.AddCurrency(-Price);
+
+		InWorker.Rewards.assign(1, InGame.Data.MakeItemReward(InGame.TicketId, ExchangeAmount));
+		switch (GrantItemRewards(InGame.Data, InDb, InWorker.Rewards.data(), InWorker.Rewards.size()))
+		{
+		case EGrantResult::Success:			return EOpResult::Success;
+		case EGrantResult::InventoryFull:	return EOpResult::Rejected;
+		default:							return EOpResult::Failed;
+		}
+	}
+
+	/**
+	 * 아이템 제거 : 보유 장비 최대 5개를 음수 보상으로 지급 파이프라인에 전달
+	 */
+	EOpResult RunRemove(const FGameData& InGame, FSqliteGameDb& InDb, FWorker& InWorker)
+	{
+		InWorker.Equipments.clear();
+		if (!InDb.FindEquipments(5, InWorker.Equipments))
+		{
+			return EOpResult::Failed;
+		}
+		if (InWorker.Equipments.empty())
+		{
+			return EOpResult::Rejected;
+		}
+
+		InWorker.Rewards.clear();
+		for (const FRowId ItemId : InWorker.Equipments)
+		{
+			InWorker.Rewards.emplace_back(InGame.Data.MakeItemReward(ItemId, -1));
+		}
+
+		return GrantItemRewards(InGame.Data, InDb, InWorker.Rewards.data(), InWorker.Rewards.size()) == EGrantResult::Success ? EOpResult::Success : EOpResult::Failed;
+	}
+
+	EOpResult RunOperation(const FConfig& InConfig, const FGameData& InGame, FSqliteGameDb& InDb, FWorker& InWorker, const EOperation InOperation)
+	{
+		if (!InDb.Begin())
+		{
+			return EOpResult::Failed;
+		}
+
+		EOpResult Result = EOpResult::Failed;
+		switch (InOperation)
+		{
+		case OpPull1:		Result = RunPull(InConfig, InGame, InDb, InWorker, 1); break;
+		case OpPull10:		Result = RunPull(InConfig, InGame, InDb, InWorker, 10); break;
+		case OpExchange:	Result = RunExchange(InConfig, InGame, InDb, InWorker); break;
+		case OpRemove:		Result = RunRemove(InGame, InDb, InWorker); break;
+		default:			break;
+		}
+
+		if (Result != EOpResult::Success)
+		{
+			InDb.Rollback();
+			return Result;
+		}
+
+		return InDb.Commit() ? EOpResult::Success : EOpResult::Failed;
+	}
+
+	EOperation PickOperation(const FConfig& InConfig, FDefaultRandom& InRandom, const int32 InMixTotal)
+	{
+		int32 Roll = InRandom.RandRange(1, InMixTotal);
+		for (int32 Op = 0; Op < OpNum; ++Op)
+		{
+			Roll -= InConfig.Mix[Op];
+			if (Roll <= 0)
+			{
+				return static_cast<EOperation>(Op);
+			}
+		}
+		return OpPull1;
+	}
+
+	/**
+	 * DB 초기화 : 샤드 파일 재생성 후 계정 생성 (계정 → 샤드는 account % ShardNum)
+	 */
+	bool PrepareDatabase(const FConfig& InConfig)
+	{
+		for (int32 Shard = 0; Shard < InConfig.ShardNum; ++Shard)
+		{
+			const std::string Path = GetShardPath(InConfig, Shard);
+			for (const char* Suffix : { "", "-wal", "-shm" })
+			{
+				std::remove((Path + Suffix).c_str());
+			}
+
+			FSqliteGameDb Db;
+			if (!Db.Open(Path))
+			{
+				std::fprintf(stderr, "failed to open %s\n", Path.c_str());
+				return false;
+			}
+
+			std::vector<int64> Accounts;
+			for (int64 Account = Shard; Account < InConfig.AccountNum; Account += InConfig.ShardNum)
+			{
+				Accounts.emplace_back(Account);
+			}
+
+			if (!Db.CreateAccounts(Accounts, InConfig.MaxCapacity, InConfig.InitialCurrency))
+			{
+				std::fprintf(stderr, "failed to create accounts in %s\n", Path.c_str());
+				return false;
+			}
+		}
+		return true;
+	}
+
+	double GetPercentileMs(const std::vector<uint64>& InSorted, const double InPercentile)
+	{
+		if (InSorted.empty())
+		{
+			return 0.0;
+		}
+		const size_t Index = std::min(InSorted.size() - 1, static_cast<size_t>(InPercentile / 100.0 * static_cast<double>(InSorted.size())));
+		return static_cast<double>(InSorted[Index]) / 1.0e6;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	FConfig Config;
+	for (int Index = 1; Index < argc; ++Index)
+	{
+		const char* Arg = argv[Index];
+		auto Match = [Arg](const char* InName) -> const char*
+		{
+			const size_t Length = std::strlen(InName);
+			return std::strncmp(Arg, InName, Length) == 0 ? Arg + Length : nullptr;
+		};
+
+		if (const char* Value = Match("--accounts="))		{ Config.AccountNum = std::max(1, std::atoi(Value)); }
+		else if (const char* Value = Match("--threads="))	{ Config.ThreadNum = std::max(1, std::atoi(Value)); }
+		else if (const char* Value = Match("--duration="))	{ Config.DurationSeconds = std::atof(Value); }
+		else if (const char* Value = Match("--shards="))	{ Config.ShardNum = std::max(1, std::atoi(Value)); }
+		else if (const char* Value = Match("--db="))		{ Config.DbPrefix = Value; }
+		else if (const char* Value = Match("--seed="))		{ Config.Seed = std::strtoull(Value, nullptr, 10); }
+		else if (const char* Value = Match("--json="))		{ Config.JsonPath = Value; }
+		else if (const char* Value = Match("--mix="))
+		{
+			if (!ParseMix(Value, Config.Mix))
+			{
+				std::fprintf(stderr, "invalid --mix=%s\n", Value);
+				return 2;
+			}
+		}
+		else
+		{
+			std::fprintf(stderr, "unknown option %s\n", Arg);
+			return 2;
+		}
+	}
+
+	// 스레드별 계정 분할 (한 계정은 한 스레드만 처리, 계정 단위 직렬화)
+	Config.ThreadNum = std::min(Config.ThreadNum, Config.AccountNum);
+
+	int32 MixTotal = 0;
+	for (const int32 Weight : Config.Mix)
+	{
+		MixTotal += std::max(Weight, 0);
+	}
+	if (MixTotal <= 0)
+	{
+		std::fprintf(stderr, "empty --mix\n");
+		return 2;
+	}
+
+	if (!PrepareDatabase(Config))
+	{
+		return 1;
+	}
+
+	const FGameData Game;
+
+	std::vector<FWorker> Workers(Config.ThreadNum);
+	for (int32 WorkerIndex = 0; WorkerIndex < Config.ThreadNum; ++WorkerIndex)
+	{
+		FWorker& Worker = Workers[WorkerIndex];
+		Worker.Random.Seed(Config.Seed * 0x9E3779B97F4A7C15ull + WorkerIndex);
+
+		for (int32 Shard = 0; Shard < Config.ShardNum; ++Shard)
+		{
+			std::unique_ptr<FSqliteGameDb>& Db = Worker.Shards.emplace_back(std::make_unique<FSqliteGameDb>());
+			if (!Db->Open(GetShardPath(Config, Shard)))
+			{
+				std::fprintf(stderr, "failed to open shard %d\n", Shard);
+				return 1;
+			}
+		}
+	}
+
+	std::atomic<bool> bStop{ false };
+	std::vector<std::thread> Threads;
+	Threads.reserve(Config.ThreadNum);
+
+	const auto Begin = std::chrono::steady_clock::now();
+	for (int32 WorkerIndex = 0; WorkerIndex < Config.ThreadNum; ++WorkerIndex)
+	{
+		Threads.emplace_back([&, WorkerIndex]()
+		{
+			FWorker& Worker = Workers[WorkerIndex];
+			for (int64 Account = WorkerIndex; !bStop.load(std::memory_order_relaxed); Account += Config.ThreadNum)
+			{
+				if (Account >= Config.AccountNum)
+				{
+					Account = WorkerIndex;
+				}
+
+				FSqliteGameDb& Db = *Worker.Shards[Account % Config.ShardNum];
+				Db.SetAccount(Account);
+
+				const EOperation Operation = PickOperation(Config, Worker.Random, MixTotal);
+
+				const auto OpBegin = std::chrono::steady_clock::now();
+				const EOpResult Result = RunOperation(Config, Game, Db, Worker, Operation);
+				const auto OpEnd = std::chrono::steady_clock::now();
+
+				FOpStats& Stats = Worker.Stats[Operation];
+				Stats.LatencyNs.emplace_back(static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(OpEnd - OpBegin).count()));
+				Stats.Rejected += Result == EOpResult::Rejected ? 1 : 0;
+				Stats.Failed += Result == EOpResult::Failed ? 1 : 0;
+			}
+		});
+	}
+
+	std::this_thread::sleep_for(std::chrono::duration<double>(Config.DurationSeconds));
+	bStop.store(true);
+	for (std::thread& Thread : Threads)
+	{
+		Thread.join();
+	}
+	const double ElapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - Begin).count();
+
+	// 결과 집계
+	uint64 CommitCount = 0;
+	uint64 RollbackCount = 0;
+	for (const FWorker& Worker : Workers)
+	{
+		for (const std::unique_ptr<FSqliteGameDb>& Db : Worker.Shards)
+		{
+			CommitCount += Db->GetCommitCount();
+			RollbackCount += Db->GetRollbackCount();
+		}
+	}
+
+	std::printf("accounts=%d threads=%d shards=%d elapsed=%.2fs\n", Config.AccountNum, Config.ThreadNum, Config.ShardNum, ElapsedSeconds);
+	std::printf("%-10s %10s %10s %9s %9s %9s %9s %9s\n", "op", "count", "ops/s", "p50 ms", "p99 ms", "p999 ms", "rejected", "failed");
+
+	std::string Json = "{\n\t\"schema\": \"reward-loadgen/1\",\n\t\"elapsed_seconds\": " + std::to_string(ElapsedSeconds) + ",\n\t\"operations\": [\n";
+	for (int32 Op = 0; Op < OpNum; ++Op)
+	{
+		std::vector<uint64> Latencies;
+		uint64 Rejected = 0;
+		uint64 Failed = 0;
+		for (const FWorker& Worker : Workers)
+		{
+			Latencies.insert(Latencies.end(), Worker.Stats[Op].LatencyNs.begin(), Worker.Stats[Op].LatencyNs.end());
+			Rejected += Worker.Stats[Op].Rejected;
+			Failed += Worker.Stats[Op].Failed;
+		}
+		std::sort(Latencies.begin(), Latencies.end());
+
+		const double Throughput = static_cast<double>(Latencies.size()) / ElapsedSeconds;
+		const double P50 = GetPercentileMs(Latencies, 50.0);
+		const double P99 = GetPercentileMs(Latencies, 99.0);
+		const double P999 = GetPercentileMs(Latencies, 99.9);
+
+		std::printf("%-10s %10zu %10.1f %9.3f %9.3f %9.3f %9llu %9llu\n", OperationNames[Op], Latencies.size(), Throughput, P50, P99, P999,
+			static_cast<unsigned long long>(Rejected), static_cast<unsigned long long>(Failed));
+
+		char Line[512];
+		std::snprintf(Line, sizeof(Line), "\t\t{ \"name\": \"%s\", \"count\": %zu, \"ops_per_sec\": %.1f, \"p50_ms\": %.3f, \"p99_ms\": %.3f, \"p999_ms\": %.3f, \"rejected\": %llu, \"failed\": %llu }%s\n",
+			OperationNames[Op], Latencies.size(), Throughput, P50, P99, P999, static_cast<unsigned long long>(Rejected), static_cast<unsigned long long>(Failed), Op + 1 < OpNum ? "," : "");
+		Json += Line;
+	}
+
+	const double CommitRate = static_cast<double>(CommitCount) / ElapsedSeconds;
+	std::printf("db commits=%llu (%.1f/s) rollbacks=%llu\n", static_cast<unsigned long long>(CommitCount), CommitRate, static_cast<unsigned long long>(RollbackCount));
+
+	Json += "\t],\n\t\"commits\": " + std::to_string(CommitCount) + ",\n\t\"commits_per_sec\": " + std::to_string(CommitRate) + ",\n\t\"rollbacks\": " + std::to_string(RollbackCount) + "\n}\n";
+	if (!Config.JsonPath.empty())
+	{
+		std::ofstream(Config.JsonPath, std::ios::binary | std::ios::trunc) << Json;
+	}
+
+	return 0;
+}
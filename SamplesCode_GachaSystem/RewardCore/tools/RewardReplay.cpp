@@ -0,0 +1,455 @@
+/**
+ * RewardCore Tools - Reward Replay
+ *
+ * 트래픽 로그(RewardTrafficCapture / --synthesize)를 로컬 SQLite 게임 DB에 결정적으로 재실행
+ * - 레코드마다 기록된 사전 상태(피티, 보유 수량, 슬롯 수)를 DB에 동기화
+ * - 난수는 기록된 시드로 초기화 후 기록된 생성 위치까지 건너뛰기
+ * - 결과(보상 목록, 피티, 병합 결과, 슬롯 판정, 수량)를 기록과 비교
+ *
+ * URewardManager::Simulate 등 엔진 전용 검증은 재현 대상이 아님 (Unchecked 레코드는 병합 결과만 비교)
+ *
+ * 사용법:
+ *   RewardReplay <로그.rwtl> [--db=replay.db] [--max-report=20]
+ *   RewardReplay --synthesize=<로그.rwtl> [--records=10000] [--seed=1]
+ *
+ * 종료 코드 : 불일치 없음 0, 불일치 1, 입력 오류 2
+ */
+
+#include "SqliteGameDb.h"
+#include "SyntheticRewardData.h"
+#include "RewardCore/DefaultRandom.h"
+#include "RewardCore/GachaRoller.h"
+#include "RewardCore/RewardDataImage.h"
+#include "RewardCore/RewardExpander.h"
+#include "RewardCore/SlotSimulator.h"
+#include "RewardCore/TrafficLog.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <unordered_set>
+
+using namespace RewardTools;
+
+namespace
+{
+	struct FConfig
+	{
+		std::string LogPath;
+		std::string DbPath = "replay.db";
+		int32 MaxReport = 20;
+
+		std::string SynthesizePath;
+		int32 RecordNum = 10000;
+		uint64 Seed = 1;
+	};
+
+	const char* GetRecordName(const uint16 InType)
+	{
+		switch (static_cast<ETrafficRecord>(InType))
+		{
+		case ETrafficRecord::DataImage:			return "data";
+		case ETrafficRecord::Gacha:				return "gacha";
+		case ETrafficRecord::Expand:			return "expand";
+		case ETrafficRecord::Simulate:			return "simulate";
+		case ETrafficRecord::InventoryChange:	return "inventory";
+		default:								return "unknown";
+		}
+	}
+
+	bool IsSameRewards(const FPackedRewardArray& InA, const FPackedRewardArray& InB)
+	{
+		return std::equal(InA.begin(), InA.end(), InB.begin(), InB.end(), [](const FPackedReward& A, const FPackedReward& B)
+		{
+			return A.Id == B.Id && A.Amount == B.Amount && A.RewardType == B.RewardType && A.AcquireSource == B.AcquireSource && A.Flags == B.Flags;
+		});
+	}
+
+	bool IsSamePity(const FPityState& InA, const FPityState& InB)
+	{
+		return InA.NormalCounter == InB.NormalCounter && InA.SpecialCounter == InB.SpecialCounter;
+	}
+
+	class FReplayer
+	{
+	public:
+		explicit FReplayer(const FConfig& InConfig) : Config(InConfig) {}
+
+		bool Open()
+		{
+			for (const char* Suffix : { "", "-wal", "-shm" })
+			{
+				std::remove((Config.DbPath + Suffix).c_str());
+			}
+			return Db.Open(Config.DbPath);
+		}
+
+		/**
+		 * 레코드 1개 재실행
+		 * @return 입력 오류(손상/데이터 없음) 시 false, 불일치는 MismatchNum으로 집계
+		 */
+		bool Replay(const FTrafficRecordHeader& InHeader, const uint8* InPayload)
+		{
+			++RecordCounts[std::min<uint16>(InHeader.Type, RecordTypeNum - 1)];
+
+			if (InHeader.Type == static_cast<uint16>(ETrafficRecord::DataImage))
+			{
+				Image = std::make_unique<FRewardDataImage>();
+				return Image->Deserialize(InPayload, InHeader.PayloadSize);
+			}
+
+			// 생성 위치는 작업 1회 분량 (손상된 헤더로 건너뛰기가 끝나지 않는 것 방지)
+			if (!Image || InHeader.RandomCounter > MaxRandomCounter || !PrepareAccount(InHeader.AccountId))
+			{
+				return false;
+			}
+
+			Random.Seed(InHeader.RandomSeed);
+			Random.Discard(InHeader.RandomCounter);
+
+			switch (static_cast<ETrafficRecord>(InHeader.Type))
+			{
+			case ETrafficRecord::Gacha:				return ReplayGacha(InHeader, InPayload);
+			case ETrafficRecord::Expand:			return ReplayExpand(InHeader, InPayload);
+			case ETrafficRecord::Simulate:			return ReplaySimulate(InHeader, InPayload);
+			case ETrafficRecord::InventoryChange:	return ReplayInventory(InHeader, InPayload);
+			default:								return true;	// 이후 버전의 레코드는 건너뛰기
+			}
+		}
+
+		static constexpr uint16 RecordTypeNum = 6;
+		static constexpr uint64 MaxRandomCounter = 1ull << 24;
+
+		uint64 RecordCounts[RecordTypeNum] = {};
+		uint64 MismatchNum = 0;
+		uint64 RecordIndex = 0;
+
+	private:
+		bool PrepareAccount(const int64 InAccountId)
+		{
+			Db.SetAccount(InAccountId);
+			if (Accounts.insert(InAccountId).second)
+			{
+				return Db.CreateAccounts({ InAccountId }, 0, 0);
+			}
+			return true;
+		}
+
+		void ReportMismatch(const FTrafficRecordHeader& InHeader, const char* InWhat)
+		{
+			if (MismatchNum++ < static_cast<uint64>(Config.MaxReport))
+			{
+				std::printf("mismatch #%llu %s account=%lld : %s\n", static_cast<unsigned long long>(RecordIndex), GetRecordName(InHeader.Type),
+					static_cast<long long>(InHeader.AccountId), InWhat);
+			}
+		}
+
+		/**
+		 * 피티 사전 상태 저장 → 로드/뽑기/저장 → 결과 보상, 저장된 피티 비교
+		 */
+		bool ReplayGacha(const FTrafficRecordHeader& InHeader, const uint8* InPayload)
+		{
+			FGachaTraffic Traffic;
+			if (!FTrafficLogReader::ReadGacha(InPayload, InHeader.PayloadSize, Traffic) || !Db.Begin())
+			{
+				return false;
+			}
+
+			Db.SavePity(Traffic.RewardId, Traffic.PityBefore);
+
+			FPackedRewardArray Rewards;
+			const bool bPulled = PullGacha(*Image, Db, Random, Traffic.RewardId, Traffic.Config, Traffic.PullCount, Rewards);
+
+			FPityState PityAfter;
+			Db.LoadPity(Traffic.RewardId, PityAfter);
+
+			if (bPulled != Traffic.bSucceeded)
+			{
+				ReportMismatch(InHeader, "pull result");
+			}
+			else if (!IsSameRewards(Rewards, Traffic.Rewards))
+			{
+				ReportMismatch(InHeader, "rewards");
+			}
+			else if (!IsSamePity(PityAfter, Traffic.PityAfter))
+			{
+				ReportMismatch(InHeader, "pity counter");
+			}
+			return Db.Commit();
+		}
+
+		bool ReplayExpand(const FTrafficRecordHeader& InHeader, const uint8* InPayload)
+		{
+			FExpandTraffic Traffic;
+			if (!FTrafficLogReader::ReadExpand(InPayload, InHeader.PayloadSize, Traffic))
+			{
+				return false;
+			}
+
+			FPackedRewardArray Rewards;
+			ExpandReward(*Image, Traffic.RewardId, Random, Rewards);
+			if (!IsSameRewards(Rewards, Traffic.Rewards))
+			{
+				ReportMismatch(InHeader, "expanded rewards");
+			}
+			return true;
+		}
+
+		/**
+		 * 조회된 보유 수량/슬롯 수 동기화 → 병합 → 슬롯 판정 (DB 변경 없음, 롤백)
+		 */
+		bool ReplaySimulate(const FTrafficRecordHeader& InHeader, const uint8* InPayload)
+		{
+			FSimulateTraffic Traffic;
+			if (!FTrafficLogReader::ReadSimulate(InPayload, InHeader.PayloadSize, Traffic) || !Db.Begin())
+			{
+				return false;
+			}
+
+			Db.SetInventoryState(Traffic.SlotCount, Traffic.MaxCapacity);
+			for (const FInventoryAmount& Amount : Traffic.Amounts)
+			{
+				Db.SetAmount(Amount.ItemId, Amount.Amount);
+			}
+
+			FPackedRewardArray Merged;
+			MergeItemRewards(*Image, Traffic.Items.data(), Traffic.Items.size(), Traffic.AcquireSource, Merged);
+
+			if (!IsSameRewards(Merged, Traffic.Merged))
+			{
+				ReportMismatch(InHeader, "merged rewards");
+			}
+			else if (Traffic.Outcome != ESimulateOutcome::Unchecked)
+			{
+				FSlotSimulator Slots(Db);
+				const bool bFits = Slots.AddRewards(*Image, Merged.data(), Merged.size());
+				if (bFits != (Traffic.Outcome == ESimulateOutcome::Passed))
+				{
+					ReportMismatch(InHeader, "inventory capacity");
+				}
+			}
+
+			Db.Rollback();
+			return true;
+		}
+
+		bool ReplayInventory(const FTrafficRecordHeader& InHeader, const uint8* InPayload)
+		{
+			FInventoryTraffic Traffic;
+			if (!FTrafficLogReader::ReadInventory(InPayload, InHeader.PayloadSize, Traffic) || !Db.Begin())
+			{
+				return false;
+			}
+
+			if (!Db.SetAmount(Traffic.ItemId, Traffic.AmountBefore) || !Db.ApplyItem(Traffic.ItemId, Traffic.Item, Traffic.Amount))
+			{
+				Db.Rollback();
+				return false;
+			}
+
+			if (Db.GetAmount(Traffic.ItemId) != std::max(Traffic.AmountBefore + Traffic.Amount, 0))
+			{
+				ReportMismatch(InHeader, "item amount");
+			}
+			return Db.Commit();
+		}
+
+		const FConfig& Config;
+		FSqliteGameDb Db;
+		FDefaultRandom Random;
+		std::unique_ptr<FRewardDataImage> Image;
+		std::unordered_set<int64> Accounts;
+	};
+
+	int RunReplay(const FConfig& InConfig)
+	{
+		std::ifstream File(InConfig.LogPath, std::ios::binary);
+		const std::vector<uint8> Log((std::istreambuf_iterator<char>(File)), std::istreambuf_iterator<char>());
+
+		FTrafficLogReader Reader(Log.data(), Log.size());
+		if (!Reader.IsValid())
+		{
+			std::fprintf(stderr, "not a traffic log: %s\n", InConfig.LogPath.c_str());
+			return 2;
+		}
+
+		FReplayer Replayer(InConfig);
+		if (!Replayer.Open())
+		{
+			std::fprintf(stderr, "failed to open %s\n", InConfig.DbPath.c_str());
+			return 2;
+		}
+
+		const auto StartTime = std::chrono::steady_clock::now();
+
+		FTrafficRecordHeader Header;
+		const uint8* Payload = nullptr;
+		while (Reader.Next(Header, Payload))
+		{
+			if (!Replayer.Replay(Header, Payload))
+			{
+				std::fprintf(stderr, "record #%llu (%s) could not be replayed\n", static_cast<unsigned long long>(Replayer.RecordIndex), GetRecordName(Header.Type));
+				return 2;
+			}
+			++Replayer.RecordIndex;
+		}
+
+		const double ElapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+		const double Rate = ElapsedSeconds > 0.0 ? static_cast<double>(Replayer.RecordIndex) / ElapsedSeconds : 0.0;
+
+		std::printf("records=%llu (%.1f/s) elapsed=%.2fs%s\n", static_cast<unsigned long long>(Replayer.RecordIndex), Rate, ElapsedSeconds,
+			Reader.IsValid() ? "" : " (truncated tail ignored)");
+		for (uint16 Type = 1; Type < FReplayer::RecordTypeNum; ++Type)
+		{
+			std::printf("  %-10s %llu\n", GetRecordName(Type), static_cast<unsigned long long>(Replayer.RecordCounts[Type]));
+		}
+		std::printf("mismatches=%llu\n", static_cast<unsigned long long>(Replayer.MismatchNum));
+
+		return Replayer.MismatchNum > 0 ? 1 : 0;
+	}
+
+	/**
+	 * 합성 트래픽 기록 (UE 캡처와 같은 호출 순서 : 뽑기 → 시뮬레이션 → 수량 변경, 보상팩 전개)
+	 */
+	int RunSynthesize(const FConfig& InConfig)
+	{
+		static constexpr int32 AccountNum = 16;
+		static constexpr int32 ItemNum = 256;
+		static constexpr int32 MaxCapacity = 200;
+
+		FSyntheticRewardData Data;
+		Data.AddItems(ItemNum);
+		const FRowId GachaId = Data.AddGachaReward(100, InConfig.Seed);
+		const FRowId TreeId = Data.AddRewardTree(4, 2);
+
+		FPityConfig PityConfig;
+		PityConfig.NormalPickupGroup = 1;
+		PityConfig.SpecialPickupGroup = 2;
+		PityConfig.SpecialTryCount = 80;
+
+		std::vector<FMemoryPityStore> PityStores(AccountNum);
+		std::vector<FMemoryInventory> Inventories(AccountNum, FMemoryInventory(ItemNum, MaxCapacity));
+
+		FTrafficLogWriter Writer;
+		Writer.WriteFileHeader();
+		Writer.WriteDataImage(FTrafficRecordHeader(), Data);
+
+		FDefaultRandom Picker(InConfig.Seed);
+		for (int32 Index = 0; Index < InConfig.RecordNum; ++Index)
+		{
+			FTrafficRecordHeader Header;
+			Header.AccountId = Picker.RandRange(0, AccountNum - 1);
+			Header.Timestamp = Index;
+
+			FDefaultRandom Random(Picker.Next());
+			Random.Discard(static_cast<uint64>(Picker.RandRange(0, 3)));
+			Header.RandomSeed = Random.GetSeed();
+			Header.RandomCounter = Random.GetCounter();
+
+			if (Picker.RandRange(0, 9) == 0)
+			{
+				FExpandTraffic Traffic;
+				Traffic.RewardId = TreeId;
+				ExpandReward(Data, TreeId, Random, Traffic.Rewards);
+				Writer.WriteExpand(Header, Traffic);
+				continue;
+			}
+
+			FGachaTraffic Gacha;
+			Gacha.RewardId = GachaId;
+			Gacha.PullCount = Picker.RandRange(0, 1) ? 10 : 1;
+			Gacha.Config = PityConfig;
+			FMemoryPityStore& PityStore = PityStores[Header.AccountId];
+			PityStore.LoadPity(GachaId, Gacha.PityBefore);
+			Gacha.bSucceeded = PullGacha(Data, PityStore, Random, GachaId, PityConfig, Gacha.PullCount, Gacha.Rewards);
+			PityStore.LoadPity(GachaId, Gacha.PityAfter);
+			Writer.WriteGacha(Header, Gacha);
+
+			FMemoryInventory& Inventory = Inventories[Header.AccountId];
+
+			FSimulateTraffic Simulate;
+			Simulate.Items = Gacha.Rewards;
+			Simulate.SlotCount = Inventory.GetItemSlotCount();
+			Simulate.MaxCapacity = Inventory.GetMaxCapacity();
+			MergeItemRewards(Data, Simulate.Items.data(), Simulate.Items.size(), 0, Simulate.Merged);
+
+			const FRecordingInventoryView RecordingInventory(Inventory, Simulate.Amounts);
+			FSlotSimulator Slots(RecordingInventory);
+			const bool bFits = Slots.AddRewards(Data, Simulate.Merged.data(), Simulate.Merged.size());
+			Simulate.Outcome = bFits ? ESimulateOutcome::Passed : ESimulateOutcome::InventoryFull;
+			Header.RandomSeed = Header.RandomCounter = 0;
+			Writer.WriteSimulate(Header, Simulate);
+
+			// 가득 차면 지급 대신 보유 아이템 정리 (이후 시뮬레이션이 계속 통과/실패 양쪽을 거치도록)
+			for (const FPackedReward& Reward : Simulate.Merged)
+			{
+				FInventoryTraffic Change;
+				Change.ItemId = Reward.Id;
+				Change.AmountBefore = Inventory.GetAmount(Reward.Id);
+				Change.Amount = bFits ? Reward.Amount : -Change.AmountBefore;
+				Change.Item = *Data.GetItemDefinition(Reward.Id);
+				if (Change.Amount != 0)
+				{
+					Inventory.AddAmount(Data, Reward.Id, Change.Amount);
+					Writer.WriteInventory(Header, Change);
+				}
+			}
+		}
+
+		std::ofstream File(InConfig.SynthesizePath, std::ios::binary);
+		File.write(reinterpret_cast<const char*>(Writer.GetBuffer().data()), static_cast<std::streamsize>(Writer.GetSize()));
+		if (!File)
+		{
+			std::fprintf(stderr, "failed to write %s\n", InConfig.SynthesizePath.c_str());
+			return 2;
+		}
+
+		std::printf("wrote %s (%zu bytes)\n", InConfig.SynthesizePath.c_str(), Writer.GetSize());
+		return 0;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	FConfig Config;
+	for (int Index = 1; Index < argc; ++Index)
+	{
+		const char* Arg = argv[Index];
+		auto Match = [Arg](const char* InName) -> const char*
+		{
+			const size_t Length = std::strlen(InName);
+			return std::strncmp(Arg, InName, Length) == 0 ? Arg + Length : nullptr;
+		};
+
+		if (const char* Value = Match("--db="))					{ Config.DbPath = Value; }
+		else if (const char* Value = Match("--max-report="))	{ Config.MaxReport = std::max(0, std::atoi(Value)); }
+		else if (const char* Value = Match("--synthesize="))	{ Config.SynthesizePath = Value; }
+		else if (const char* Value = Match("--records="))		{ Config.RecordNum = std::max(1, std::atoi(Value)); }
+		else if (const char* Value = Match("--seed="))			{ Config.Seed = std::strtoull(Value, nullptr, 10); }
+		else if (Arg[0] != '-' && Config.LogPath.empty())		{ Config.LogPath = Arg; }
+		else
+		{
+			std::fprintf(stderr, "unknown option %s\n", Arg);
+			return 2;
+		}
+	}
+
+	if (!Config.SynthesizePath.empty())
+	{
+		return RunSynthesize(Config);
+	}
+
+	if (Config.LogPath.empty())
+	{
+		std::fprintf(stderr, "usage: RewardReplay <log.rwtl> [--db=replay.db] [--max-report=20]\n");
+		std::fprintf(stderr, "       RewardReplay --synthesize=<log.rwtl> [--records=10000] [--seed=1]\n");
+		return 2;
+	}
+
+	return RunReplay(Config);
+}
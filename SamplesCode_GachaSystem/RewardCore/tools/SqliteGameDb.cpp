@@ -0,0 +1,321 @@
+/**
+ * RewardCore Tools - SQLite Game DB Implementation
+ *
+ * 스키마:
+ * - account : 슬롯 수/최대 용량/유료 재화 (슬롯 수는 변경 시 갱신, 조회는 행 1개)
+ * - item : 계정별 아이템 총 수량 (스택 가능/불가 공통)
+ * - equipment : 스택 불가 아이템 인스턴스 (수량 1당 행 1개, UID 부여)
+ * - gacha_counter : 계정/가챠 묶음별 피티 카운터
+ */
+
+#include "SqliteGameDb.h"
+#include <sqlite3.h>
+
+namespace RewardTools
+{
+	namespace
+	{
+		const char* const SchemaSql =
+			"PRAGMA journal_mode=WAL;"
+			"PRAGMA synchronous=NORMAL;"
+			"CREATE TABLE IF NOT EXISTS account (account_id INTEGER PRIMARY KEY, slot_count INTEGER NOT NULL, max_capacity INTEGER NOT NULL, currency INTEGER NOT NULL);"
+			"CREATE TABLE IF NOT EXISTS item (account_id INTEGER NOT NULL, item_id INTEGER NOT NULL, amount INTEGER NOT NULL, PRIMARY KEY (account_id, item_id)) WITHOUT ROWID;"
+			"CREATE TABLE IF NOT EXISTS equipment (uid INTEGER PRIMARY KEY AUTOINCREMENT, account_id INTEGER NOT NULL, item_id INTEGER NOT NULL);"
+			"CREATE INDEX IF NOT EXISTS equipment_account ON equipment (account_id, item_id);"
+			"CREATE TABLE IF NOT EXISTS gacha_counter (account_id INTEGER NOT NULL, reward_id INTEGER NOT NULL, normal INTEGER NOT NULL, special INTEGER NOT NULL, PRIMARY KEY (account_id, reward_id)) WITHOUT ROWID;";
+
+		const char* const StatementSql[] =
+		{
+			"BEGIN IMMEDIATE",
+			"COMMIT",
+			"ROLLBACK",
+			"INSERT OR REPLACE INTO account (account_id, slot_count, max_capacity, currency) VALUES (?1, 0, ?2, ?3)",
+			"SELECT slot_count, max_capacity, currency FROM account WHERE account_id = ?1",
+			"UPDATE account SET slot_count = ?2, currency = ?3 WHERE account_id = ?1",
+			"SELECT amount FROM item WHERE account_id = ?1 AND item_id = ?2",
+			"INSERT INTO item (account_id, item_id, amount) VALUES (?1, ?2, ?3) ON CONFLICT (account_id, item_id) DO UPDATE SET amount = ?3",
+			"DELETE FROM item WHERE account_id = ?1 AND item_id = ?2",
+			"INSERT INTO equipment (account_id, item_id) VALUES (?1, ?2)",
+			"DELETE FROM equipment WHERE uid IN (SELECT uid FROM equipment WHERE account_id = ?1 AND item_id = ?2 ORDER BY uid LIMIT ?3)",
+			"SELECT item_id FROM equipment WHERE account_id = ?1 ORDER BY uid LIMIT ?2",
+			"SELECT normal, special FROM gacha_counter WHERE account_id = ?1 AND reward_id = ?2",
+			"INSERT INTO gacha_counter (account_id, reward_id, normal, special) VALUES (?1, ?2, ?3, ?4) ON CONFLICT (account_id, reward_id) DO UPDATE SET normal = ?3, special = ?4",
+		};
+		static_assert(sizeof(StatementSql) / sizeof(StatementSql[0]) == 14, "StatementSql must match EStatement");
+
+		/**
+		 * 실행 후 재사용 가능하도록 리셋 (RAII)
+		 */
+		struct FStatementScope
+		{
+			sqlite3_stmt* Statement;
+
+			explicit FStatementScope(sqlite3_stmt* InStatement) : Statement(InStatement) {}
+			~FStatementScope()
+			{
+				sqlite3_reset(Statement);
+				sqlite3_clear_bindings(Statement);
+			}
+		};
+	}
+
+	FSqliteGameDb::~FSqliteGameDb()
+	{
+		Close();
+	}
+
+	bool FSqliteGameDb::Open(const std::string& InPath)
+	{
+		Close();
+
+		if (sqlite3_open_v2(InPath.c_str(), &Db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_NOMUTEX, nullptr) != SQLITE_OK)
+		{
+			Close();
+			return false;
+		}
+
+		sqlite3_busy_timeout(Db, 5000);
+
+		if (sqlite3_exec(Db, SchemaSql, nullptr, nullptr, nullptr) != SQLITE_OK)
+		{
+			Close();
+			return false;
+		}
+
+		for (int32 Index = 0; Index < StmtNum; ++Index)
+		{
+			if (sqlite3_prepare_v3(Db, StatementSql[Index], -1, SQLITE_PREPARE_PERSISTENT, &Statements[Index], nullptr) != SQLITE_OK)
+			{
+				Close();
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void FSqliteGameDb::Close()
+	{
+		for (sqlite3_stmt*& Statement : Statements)
+		{
+			sqlite3_finalize(Statement);
+			Statement = nullptr;
+		}
+
+		if (Db)
+		{
+			sqlite3_close(Db);
+			Db = nullptr;
+		}
+		bInTransaction = false;
+	}
+
+	bool FSqliteGameDb::Execute(const EStatement InStatement)
+	{
+		FStatementScope Scope(Statements[InStatement]);
+		return sqlite3_step(Scope.Statement) == SQLITE_DONE;
+	}
+
+	bool FSqliteGameDb::CreateAccounts(const std::vector<int64>& InAccountIds, const int32 InMaxCapacity, const int64 InCurrency)
+	{
+		if (bInTransaction || !Execute(StmtBegin))
+		{
+			return false;
+		}
+
+		for (const int64 Account : InAccountIds)
+		{
+			FStatementScope Scope(Statements[StmtInsertAccount]);
+			sqlite3_bind_int64(Scope.Statement, 1, Account);
+			sqlite3_bind_int(Scope.Statement, 2, InMaxCapacity);
+			sqlite3_bind_int64(Scope.Statement, 3, InCurrency);
+			if (sqlite3_step(Scope.Statement) != SQLITE_DONE)
+			{
+				Execute(StmtRollback);
+				return false;
+			}
+		}
+
+		return Execute(StmtCommit);
+	}
+
+	bool FSqliteGameDb::Begin()
+	{
+		if (bInTransaction || !Execute(StmtBegin))
+		{
+			return false;
+		}
+		bInTransaction = true;
+
+		FStatementScope Scope(Statements[StmtSelectAccount]);
+		sqlite3_bind_int64(Scope.Statement, 1, AccountId);
+		if (sqlite3_step(Scope.Statement) != SQLITE_ROW)
+		{
+			Rollback();
+			return false;
+		}
+
+		SlotCount = sqlite3_column_int(Scope.Statement, 0);
+		MaxCapacity = sqlite3_column_int(Scope.Statement, 1);
+		Currency = sqlite3_column_int64(Scope.Statement, 2);
+		return true;
+	}
+
+	bool FSqliteGameDb::Commit()
+	{
+		if (!bInTransaction)
+		{
+			return false;
+		}
+
+		{
+			FStatementScope Scope(Statements[StmtUpdateAccount]);
+			sqlite3_bind_int64(Scope.Statement, 1, AccountId);
+			sqlite3_bind_int(Scope.Statement, 2, SlotCount);
+			sqlite3_bind_int64(Scope.Statement, 3, Currency);
+			if (sqlite3_step(Scope.Statement) != SQLITE_DONE)
+			{
+				Rollback();
+				return false;
+			}
+		}
+
+		if (!Execute(StmtCommit))
+		{
+			Rollback();
+			return false;
+		}
+
+		bInTransaction = false;
+		++CommitCount;
+		return true;
+	}
+
+	void FSqliteGameDb::Rollback()
+	{
+		if (!bInTransaction)
+		{
+			return;
+		}
+
+		Execute(StmtRollback);
+		bInTransaction = false;
+		++RollbackCount;
+	}
+
+	bool FSqliteGameDb::FindEquipments(const int32 InMaxNum, std::vector<FRowId>& OutItemIds)
+	{
+		FStatementScope Scope(Statements[StmtSelectEquipments]);
+		sqlite3_bind_int64(Scope.Statement, 1, AccountId);
+		sqlite3_bind_int(Scope.Statement, 2, InMaxNum);
+
+		int Result = SQLITE_ROW;
+		while ((Result = sqlite3_step(Scope.Statement)) == SQLITE_ROW)
+		{
+			OutItemIds.emplace_back(static_cast<FRowId>(sqlite3_column_int64(Scope.Statement, 0)));
+		}
+		return Result == SQLITE_DONE;
+	}
+
+	void FSqliteGameDb::LoadPity(const FRowId InRewardId, FPityState& OutState)
+	{
+		OutState = FPityState();
+
+		FStatementScope Scope(Statements[StmtSelectCounter]);
+		sqlite3_bind_int64(Scope.Statement, 1, AccountId);
+		sqlite3_bind_int64(Scope.Statement, 2, InRewardId);
+		if (sqlite3_step(Scope.Statement) == SQLITE_ROW)
+		{
+			OutState.NormalCounter = sqlite3_column_int(Scope.Statement, 0);
+			OutState.SpecialCounter = sqlite3_column_int(Scope.Statement, 1);
+		}
+	}
+
+	void FSqliteGameDb::SavePity(const FRowId InRewardId, const FPityState& InState)
+	{
+		FStatementScope Scope(Statements[StmtUpsertCounter]);
+		sqlite3_bind_int64(Scope.Statement, 1, AccountId);
+		sqlite3_bind_int64(Scope.Statement, 2, InRewardId);
+		sqlite3_bind_int(Scope.Statement, 3, InState.NormalCounter);
+		sqlite3_bind_int(Scope.Statement, 4, InState.SpecialCounter);
+		sqlite3_step(Scope.Statement);
+	}
+
+	int32 FSqliteGameDb::GetAmount(const FRowId InItemId) const
+	{
+		FStatementScope Scope(Statements[StmtSelectAmount]);
+		sqlite3_bind_int64(Scope.Statement, 1, AccountId);
+		sqlite3_bind_int64(Scope.Statement, 2, InItemId);
+		return sqlite3_step(Scope.Statement) == SQLITE_ROW ? sqlite3_column_int(Scope.Statement, 0) : 0;
+	}
+
+	bool FSqliteGameDb::SetAmount(const FRowId InItemId, const int32 InAmount)
+	{
+		FStatementScope Scope(Statements[InAmount > 0 ? StmtUpsertAmount : StmtDeleteAmount]);
+		sqlite3_bind_int64(Scope.Statement, 1, AccountId);
+		sqlite3_bind_int64(Scope.Statement, 2, InItemId);
+		if (InAmount > 0)
+		{
+			sqlite3_bind_int(Scope.Statement, 3, InAmount);
+		}
+		return sqlite3_step(Scope.Statement) == SQLITE_DONE;
+	}
+
+	/**
+	 * 수량/장비 행/슬롯 수 갱신 (슬롯 규칙은 FSlotSimulator와 동일)
+	 */
+	bool FSqliteGameDb::ApplyItem(const FRowId InItemId, const FItemDefinition& InItem, const int32 InAmount)
+	{
+		const int32 Amount = GetAmount(InItemId);
+		const int32 NewAmount = Amount + InAmount > 0 ? Amount + InAmount : 0;
+		if (NewAmount == Amount)
+		{
+			return true;
+		}
+
+		if (!SetAmount(InItemId, NewAmount))
+		{
+			return false;
+		}
+
+		if (InItem.bNonStackable)
+		{
+			if (NewAmount > Amount)
+			{
+				for (int32 Index = Amount; Index < NewAmount; ++Index)
+				{
+					FStatementScope Scope(Statements[StmtInsertEquipment]);
+					sqlite3_bind_int64(Scope.Statement, 1, AccountId);
+					sqlite3_bind_int64(Scope.Statement, 2, InItemId);
+					if (sqlite3_step(Scope.Statement) != SQLITE_DONE)
+					{
+						return false;
+					}
+				}
+			}
+			else
+			{
+				FStatementScope Scope(Statements[StmtDeleteEquipment]);
+				sqlite3_bind_int64(Scope.Statement, 1, AccountId);
+				sqlite3_bind_int64(Scope.Statement, 2, InItemId);
+				sqlite3_bind_int(Scope.Statement, 3, Amount - NewAmount);
+				if (sqlite3_step(Scope.Statement) != SQLITE_DONE)
+				{
+					return false;
+				}
+			}
+		}
+
+		if (InItem.bRequiresInventorySlot)
+		{
+			if (InItem.bNonStackable)
+			{
+				SlotCount += NewAmount - Amount;
+			}
+			else if ((Amount == 0) != (NewAmount == 0))
+			{
+				SlotCount += NewAmount > 0 ? 1 : -1;
+			}
+		}
+		return true;
+	}
+}
@@ -0,0 +1,118 @@
+/**
+ * RewardCore Tools - SQLite Game DB
+ *
+ * 로컬 SQLite 게임 DB (계정/인벤토리/장비/가챠 카운터)
+ * - 연결 1개 = 스레드 1개 (연결 간 동시 접근은 WAL + busy_timeout)
+ * - 계정 선택 후 IPityStore / IInventoryStore로 RewardCore에 연결
+ * - 트랜잭션 : Begin(BEGIN IMMEDIATE + 계정 행 로드) → Commit(계정 행 저장 + COMMIT) / Rollback
+ */
+
+#pragma once
+
+#include "RewardCore/Interfaces.h"
+#include "RewardCore/PityStateMachine.h"
+#include <string>
+#include <vector>
+
+struct sqlite3;
+struct sqlite3_stmt;
+
+namespace RewardTools
+{
+	using namespace RewardCore;
+
+	class FSqliteGameDb final : public IPityStore, public IInventoryStore
+	{
+	public:
+		FSqliteGameDb() = default;
+		~FSqliteGameDb();
+
+		FSqliteGameDb(const FSqliteGameDb&) = delete;
+		FSqliteGameDb& operator=(const FSqliteGameDb&) = delete;
+
+		/**
+		 * 연결 (스키마가 없으면 생성)
+		 */
+		bool Open(const std::string& InPath);
+		void Close();
+
+		/**
+		 * 계정 일괄 생성 (한 트랜잭션)
+		 */
+		bool CreateAccounts(const std::vector<int64>& InAccountIds, const int32 InMaxCapacity, const int64 InCurrency);
+
+		/**
+		 * 이후 트랜잭션/조회 대상 계정
+		 */
+		void SetAccount(const int64 InAccountId) { AccountId = InAccountId; }
+		int64 GetAccount() const { return AccountId; }
+
+		bool Begin();
+		bool Commit();
+		void Rollback();
+
+		/**
+		 * 트랜잭션 중 계정 상태 덮어쓰기 (재현 시 기록된 사전 상태 동기화)
+		 * SetAmount는 수량 행만 변경 (장비 행/슬롯 수는 그대로)
+		 */
+		void SetInventoryState(const int32 InSlotCount, const int32 InMaxCapacity) { SlotCount = InSlotCount; MaxCapacity = InMaxCapacity; }
+		bool SetAmount(const FRowId InItemId, const int32 InAmount);
+
+		int64 GetCurrency() const { return Currency; }
+		void AddCurrency(const int64 InAmount) { Currency += InAmount; }
+
+		/**
+		 * 보유 장비(스택 불가 아이템) 행 ID 최대 InMaxNum개 (UID 순)
+		 */
+		bool FindEquipments(const int32 InMaxNum, std::vector<FRowId>& OutItemIds);
+
+		uint64 GetCommitCount() const { return CommitCount; }
+		uint64 GetRollbackCount() const { return RollbackCount; }
+
+		// IPityStore
+		virtual void LoadPity(const FRowId InRewardId, FPityState& OutState) override;
+		virtual void SavePity(const FRowId InRewardId, const FPityState& InState) override;
+
+		// IInventoryStore
+		virtual int32 GetItemSlotCount() const override { return SlotCount; }
+		virtual int32 GetMaxCapacity() const override { return MaxCapacity; }
+		virtual int32 GetAmount(const FRowId InItemId) const override;
+		virtual bool ApplyItem(const FRowId InItemId, const FItemDefinition& InItem, const int32 InAmount) override;
+
+	private:
+		enum EStatement
+		{
+			StmtBegin,
+			StmtCommit,
+			StmtRollback,
+			StmtInsertAccount,
+			StmtSelectAccount,
+			StmtUpdateAccount,
+			StmtSelectAmount,
+			StmtUpsertAmount,
+			StmtDeleteAmount,
+			StmtInsertEquipment,
+			StmtDeleteEquipment,
+			StmtSelectEquipments,
+			StmtSelectCounter,
+			StmtUpsertCounter,
+			StmtNum
+		};
+
+		bool Execute(const EStatement InStatement);
+
+		sqlite3* Db = nullptr;
+		sqlite3_stmt* Statements[StmtNum] = {};
+
+		int64 AccountId = 0;
+		bool bInTransaction = false;
+
+		// 트랜잭션 중 계정 행 캐시 (Commit 시 저장)
+		int32 SlotCount = 0;
+		int32 MaxCapacity = 0;
+		int64 Currency = 0;
+
+		uint64 CommitCount = 0;
+		uint64 RollbackCount = 0;
+	};
+}
@@ -0,0 +1,174 @@
+/**
+ * RewardCore Tools - Synthetic Reward Data Implementation
+ */
+
+#include "SyntheticRewardData.h"
+#include "RewardCore/DefaultRandom.h"
+
+namespace RewardTools
+{
+	namespace
+	{
+		// EReward 원본 값 (합성 데이터 전용, 코어는 Flags로만 판단)
+		constexpr uint8 RewardTypeItem = 1;
+		constexpr uint8 RewardTypeBundle = 2;
+	}
+
+	FRowId FSyntheticRewardData::AddItems(const int32 InItemNum, const int32 InNonStackableEvery/* = 8*/)
+	{
+		const FRowId FirstId = static_cast<FRowId>(Items.size());
+		Items.reserve(Items.size() + InItemNum);
+
+		for (int32 Index = 0; Index < InItemNum; ++Index)
+		{
+			FItemDefinition& Item = Items.emplace_back();
+			Item.bNonStackable = InNonStackableEvery > 0 && Index % InNonStackableEvery == 0;
+			Item.MaxStackAmount = Item.bNonStackable ? 1 : 9999;
+			Item.bRequiresInventorySlot = true;
+		}
+		return FirstId;
+	}
+
+	FRowId FSyntheticRewardData::AddGachaReward(const int32 InEntryNum, const uint64 InSeed)
+	{
+		FDefaultRandom Random(InSeed);
+
+		FRewardDefinition& Reward = Rewards.emplace_back();
+		for (int32 Index = 0; Index < InEntryNum; ++Index)
+		{
+			const int32 Roll = Random.RandRange(1, 100);
+			const int32 PickupGroup = Roll == 1 ? 2 : (Roll <= 11 ? 1 : 0);
+			const int32 Weight = PickupGroup == 2 ? 1 : (PickupGroup == 1 ? 10 : Random.RandRange(50, 150));
+
+			const FRowId ItemId = Items.empty() ? InvalidRowId : static_cast<FRowId>(Random.RandRange(0, static_cast<int32>(Items.size()) - 1));
+			Reward.Gacha.AddEntry(MakeItemReward(ItemId, 1), Weight, PickupGroup);
+			Reward.TotalGachaWeight += Weight;
+		}
+		Reward.Gacha.Compile();
+
+		return static_cast<FRowId>(Rewards.size() - 1);
+	}
+
+	/**
+	 * 자식부터 만들어 부모가 행 ID를 참조 (같은 깊이의 자식은 공유하지 않음)
+	 */
+	FRowId FSyntheticRewardData::AddRewardTree(const int32 InDepth, const int32 InFanout)
+	{
+		std::vector<FRowId> Children;
+		if (InDepth > 1)
+		{
+			for (int32 Index = 0; Index < InFanout; ++Index)
+			{
+				Children.emplace_back(AddRewardTree(InDepth - 1, InFanout));
+			}
+		}
+
+		const FRowId RowId = static_cast<FRowId>(Rewards.size());
+		const FRowId ItemNum = static_cast<FRowId>(Items.size());
+
+		FRewardDefinition& Reward = Rewards.emplace_back();
+		for (const FRowId Child : Children)
+		{
+			FPackedReward Bundle;
+			Bundle.Id = Child;
+			Bundle.Amount = 1;
+			Bundle.RewardType = RewardTypeBundle;
+			Bundle.Flags = FPackedReward::Bundle;
+			Reward.Statics.emplace_back(Bundle);
+		}
+
+		if (ItemNum > 0)
+		{
+			Reward.Statics.emplace_back(MakeItemReward((RowId * 2) % ItemNum, 1));
+			Reward.Statics.emplace_back(MakeItemReward((RowId * 2 + 1) % ItemNum, 3));
+
+			for (FRowId Index = 0; Index < 4; ++Index)
+			{
+				Reward.Randoms.AddEntry(MakeItemReward((RowId + Index * 7) % ItemNum, 1), 25);
+				Reward.TotalWeight += 25;
+			}
+			Reward.Randoms.Compile();
+		}
+
+		return RowId;
+	}
+
+	FPackedReward FSyntheticRewardData::MakeItemReward(const FRowId InItemId, const int32 InAmount) const
+	{
+		FPackedReward Reward;
+		Reward.Id = InItemId;
+		Reward.Amount = InAmount;
+		Reward.RewardType = RewardTypeItem;
+		Reward.Flags = InItemId != InvalidRowId ? static_cast<uint8>(FPackedReward::Item) : static_cast<uint8>(FPackedReward::Item | FPackedReward::NameOnly);
+		return Reward;
+	}
+
+	const FRewardDefinition* FSyntheticRewardData::GetRewardDefinition(const FRowId InRewardId) const
+	{
+		return InRewardId < Rewards.size() ? &Rewards[InRewardId] : nullptr;
+	}
+
+	const FItemDefinition* FSyntheticRewardData::GetItemDefinition(const FRowId InItemId) const
+	{
+		return InItemId < Items.size() ? &Items[InItemId] : nullptr;
+	}
+
+	void FMemoryPityStore::LoadPity(const FRowId InRewardId, FPityState& OutState)
+	{
+		const auto It = States.find(InRewardId);
+		OutState = It != States.end() ? It->second : FPityState();
+	}
+
+	void FMemoryPityStore::SavePity(const FRowId InRewardId, const FPityState& InState)
+	{
+		States[InRewardId] = InState;
+	}
+
+	FMemoryInventory::FMemoryInventory(const int32 InItemNum, const int32 InMaxCapacity)
+		: Amounts(InItemNum, 0)
+		, MaxCapacity(InMaxCapacity)
+	{
+	}
+
+	void FMemoryInventory::Fill(const IRewardData& InData, const int32 InOwnedEvery, const int32 InAmount)
+	{
+		for (int32 Index = 0; Index < static_cast<int32>(Amounts.size()); Index += InOwnedEvery)
+		{
+			AddAmount(InData, static_cast<FRowId>(Index), InAmount);
+		}
+	}
+
+	/**
+	 * 슬롯 수 갱신 규칙은 FSlotSimulator와 동일 (스택 가능 : 0 ↔ 양수 전환 시만, 스택 불가 : 수량만큼)
+	 */
+	void FMemoryInventory::AddAmount(const IRewardData& InData, const FRowId InItemId, const int32 InAmount)
+	{
+		const FItemDefinition* Item = InData.GetItemDefinition(InItemId);
+		if (!Item || InItemId >= Amounts.size())
+		{
+			return;
+		}
+
+		int32& Amount = Amounts[InItemId];
+		const int32 NewAmount = Amount + InAmount > 0 ? Amount + InAmount : 0;
+
+		if (Item->bRequiresInventorySlot)
+		{
+			if (Item->bNonStackable)
+			{
+				SlotCount += NewAmount - Amount;
+			}
+			else if ((Amount == 0) != (NewAmount == 0))
+			{
+				SlotCount += NewAmount > 0 ? 1 : -1;
+			}
+		}
+
+		Amount = NewAmount;
+	}
+
+	int32 FMemoryInventory::GetAmount(const FRowId InItemId) const
+	{
+		return InItemId < Amounts.size() ? Amounts[InItemId] : 0;
+	}
+}
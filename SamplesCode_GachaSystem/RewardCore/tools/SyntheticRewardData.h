@@ -0,0 +1,87 @@
+/**
+ * RewardCore Tools - Synthetic Reward Data
+ *
+ * 벤치마크/부하 테스트용 합성 데이터 (엔진/데이터 테이블 없이 RewardCore 인터페이스 구현)
+ * - 보상 묶음 : 가챠(가중치/픽업 그룹), 깊은 보상 트리
+ * - 아이템 : 스택 가능/불가 혼합
+ * - 메모리 피티 저장소, 메모리 인벤토리
+ */
+
+#pragma once
+
+#include "RewardCore/Interfaces.h"
+#include "RewardCore/PityStateMachine.h"
+#include <unordered_map>
+
+namespace RewardTools
+{
+	using namespace RewardCore;
+
+	class FSyntheticRewardData final : public IRewardData
+	{
+	public:
+		/**
+		 * 아이템 InItemNum개 추가 (InNonStackableEvery 번째마다 스택 불가, 모두 슬롯 필요)
+		 * @return 첫 아이템 ID
+		 */
+		FRowId AddItems(const int32 InItemNum, const int32 InNonStackableEvery = 8);
+
+		/**
+		 * 가챠 보상 묶음 추가 (아이템 보상 InEntryNum개, 픽업 그룹 2 : 1%, 1 : 10%, 나머지 0)
+		 */
+		FRowId AddGachaReward(const int32 InEntryNum, const uint64 InSeed);
+
+		/**
+		 * 보상 트리 추가
+		 * 노드마다 고정 보상 [하위 묶음 InFanout개 + 아이템 2개], 랜덤 보상 [아이템 4개 중 1개]
+		 * @return 루트 묶음 ID
+		 */
+		FRowId AddRewardTree(const int32 InDepth, const int32 InFanout);
+
+		/**
+		 * 아이템 보상 레코드
+		 */
+		FPackedReward MakeItemReward(const FRowId InItemId, const int32 InAmount) const;
+
+		virtual const FRewardDefinition* GetRewardDefinition(const FRowId InRewardId) const override;
+		virtual const FItemDefinition* GetItemDefinition(const FRowId InItemId) const override;
+		virtual int32 GetRewardDefinitionNum() const override { return static_cast<int32>(Rewards.size()); }
+		virtual int32 GetItemDefinitionNum() const override { return static_cast<int32>(Items.size()); }
+
+	private:
+		std::vector<FRewardDefinition> Rewards;
+		std::vector<FItemDefinition> Items;
+	};
+
+	class FMemoryPityStore final : public IPityStore
+	{
+	public:
+		virtual void LoadPity(const FRowId InRewardId, FPityState& OutState) override;
+		virtual void SavePity(const FRowId InRewardId, const FPityState& InState) override;
+
+	private:
+		std::unordered_map<FRowId, FPityState> States;
+	};
+
+	class FMemoryInventory final : public IInventoryView
+	{
+	public:
+		FMemoryInventory(const int32 InItemNum, const int32 InMaxCapacity);
+
+		/**
+		 * 보유 아이템 채우기 (InOwnedEvery 번째 아이템마다 InAmount개)
+		 */
+		void Fill(const IRewardData& InData, const int32 InOwnedEvery, const int32 InAmount);
+
+		void AddAmount(const IRewardData& InData, const FRowId InItemId, const int32 InAmount);
+
+		virtual int32 GetItemSlotCount() const override { return SlotCount; }
+		virtual int32 GetMaxCapacity() const override { return MaxCapacity; }
+		virtual int32 GetAmount(const FRowId InItemId) const override;
+
+	private:
+		std::vector<int32> Amounts;
+		int32 SlotCount = 0;
+		int32 MaxCapacity = 0;
+	};
+}
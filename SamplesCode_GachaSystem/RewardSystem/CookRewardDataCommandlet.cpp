@@ -0,0 +1,86 @@
+/**
+ * Cook Reward Data Commandlet Implementation
+ */
+
+#include "CookRewardDataCommandlet.h"
+#include "RewardDataBundle.h"
+#include "DataTable/GachaCampaignData.h"
+#include "DataTable/ItemDataTable.h"
+#include "DataTable/RewardData.h"
+#include "Misc/Paths.h"
+
+namespace CookRewardData
+{
+	/**
+	 * 번들 행 이름 왕복 검증 (UTF-8 쿡 → FName 복원이 테이블 행 이름과 일치)
+	 * bRequired가 false면 번들에 없는 행은 건너뜀 (판매 일정 밖 캠페인)
+	 */
+	template <typename RowType>
+	bool CheckRowName(const FRewardDataBundle& InBundle, const RowType* InRow, const FName& InRowName, const bool bRequired = true)
+	{
+		if (!InRow)
+		{
+			// 로그 : [CookRewardData] Row not found in bundle: %s
+			return !bRequired;
+		}
+
+		if (!InBundle.GetName(InRow->Name).IsEqual(InRowName, ENameCase::CaseSensitive))
+		{
+			// 로그 : [CookRewardData] Row name mismatch: %s != %s
+			return false;
+		}
+		return true;
+	}
+
+	bool CheckRowNames(const FRewardDataBundle& InBundle)
+	{
+		bool bValid = true;
+
+		URewardDataTable::Visit([&](const URewardData* Data)
+		{
+			bValid &= CheckRowName(InBundle, InBundle.FindReward(Data->DataRowName), Data->DataRowName);
+		});
+
+		UGachaCampaignDataTable::Visit([&](const FGachaCampaignData* Data)
+		{
+			bValid &= CheckRowName(InBundle, InBundle.FindCampaign(Data->DataRowName), Data->DataRowName, false);
+		});
+
+		UItemDataTable::Visit([&](const FItemBaseData* Data)
+		{
+			bValid &= CheckRowName(InBundle, InBundle.FindItem(Data->DataRowName), Data->DataRowName);
+		});
+
+		return bValid;
+	}
+}
+
+int32 UCookRewardDataCommandlet::Main(const FString& Params)
+{
+	FString OutPath = FPaths::ProjectSavedDir() / TEXT("Cooked/RewardData.bin");
+	FParse::Value(*Params, TEXT("Out="), OutPath);
+
+	if (!FRewardDataBundle::Cook(OutPath))
+	{
+		// 로그 : [CookRewardData] Failed to write %s
+		return 1;
+	}
+
+	// 검증 : 다시 로드해서 헤더/섹션 확인
+	const TSharedPtr<const FRewardDataBundle> Bundle = FRewardDataBundle::Load(OutPath);
+	if (!Bundle)
+	{
+		// 로그 : [CookRewardData] Validation failed %s
+		return 1;
+	}
+
+	// 검증 : 행 이름 왕복 (비 ASCII 행 이름 포함)
+	if (!CookRewardData::CheckRowNames(*Bundle))
+	{
+		// 로그 : [CookRewardData] Row name round-trip failed %s
+		return 1;
+	}
+
+	// 로그 : [CookRewardData] Wrote %s
+	return 0;
+}
@@ -0,0 +1,21 @@
+/**
+ * Cook Reward Data Commandlet
+ *
+ * 보상 서버용 데이터 번들 쿡
+ * 사용법 : UnrealEditor-Cmd <Project> -run=CookRewardData -Out=<경로>
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "CookRewardDataCommandlet.generated.h"
+
+UCLASS()
+class UCookRewardDataCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	virtual int32 Main(const FString& Params) override;
+};
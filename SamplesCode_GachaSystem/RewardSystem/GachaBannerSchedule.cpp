@@ -0,0 +1,165 @@
+/**
+ * Gacha Banner Schedule Implementation
+ *
+ * 구간 트리 질의 (시각 T):
+ * - T < Center : 노드 구간은 모두 Center 이후 종료 → 시작 시각 오름차순으로 Start <= T 까지 수집 후 왼쪽
+ * - T >= Center : 노드 구간은 모두 Center 이전 시작 → 종료 시각 내림차순으로 End > T 까지 수집 후 오른쪽
+ */
+
+#include "GachaBannerSchedule.h"
+
+bool FGachaBannerSchedule::ApplyScheduleRow(const UDataTable* InScheduleTable, FCompiledGachaCampaign& InOutCampaign)
+{
+	const FGachaBannerScheduleRow* Row = InScheduleTable ? InScheduleTable->FindRow<FGachaBannerScheduleRow>(InOutCampaign.RowName, TEXT("GachaBannerSchedule"), false) : nullptr;
+	if (!Row)
+	{
+		return true;
+	}
+
+	if (Row->EndTime <= Row->StartTime)
+	{
+		// 로그 : [GachaSchedule] Invalid window %s
+		return false;
+	}
+
+	InOutCampaign.StartTicks = Row->StartTime.GetTicks();
+	InOutCampaign.EndTicks = Row->EndTime.GetTicks();
+	return true;
+}
+
+/**
+ * 인덱스 구성
+ *
+ * 로직:
+ * 1. 캠페인별 판매 기간 수집
+ * 2. 구간 트리 구성
+ */
+void FGachaBannerSchedule::Build(const TArray<FCompiledGachaCampaign>& InCampaigns)
+{
+	Windows.Reset(InCampaigns.Num());
+	Nodes.Reset();
+	ByStart.Reset(InCampaigns.Num());
+	ByEnd.Reset(InCampaigns.Num());
+	WindowsByRewardGroup.Reset();
+	RootNode = INDEX_NONE;
+
+	for (const FCompiledGachaCampaign& Campaign : InCampaigns)
+	{
+		FWindow Window;
+		Window.Campaign = &Campaign;
+		Window.StartTicks = Campaign.StartTicks;
+		Window.EndTicks = Campaign.EndTicks;
+
+		WindowsByRewardGroup.Add(Campaign.RewardGroupRowName, Windows.Emplace(Window));
+	}
+
+	TArray<int32> WindowIndices;
+	WindowIndices.Reserve(Windows.Num());
+	for (int32 Index = 0; Index < Windows.Num(); ++Index)
+	{
+		WindowIndices.Emplace(Index);
+	}
+
+	RootNode = BuildNode(WindowIndices);
+
+	// 로그 : [GachaSchedule] %d windows, %d nodes
+}
+
+/**
+ * 구간 트리 노드 구성 (재귀)
+ *
+ * Center = 시작 시각의 중앙값
+ * → 해당 구간은 반드시 Center를 포함하므로 매 단계 최소 1개씩 소진
+ */
+int32 FGachaBannerSchedule::BuildNode(TArray<int32>& InWindowIndices)
+{
+	if (InWindowIndices.IsEmpty())
+	{
+		return INDEX_NONE;
+	}
+
+	InWindowIndices.Sort([this](const int32 A, const int32 B) { return Windows[A].StartTicks < Windows[B].StartTicks; });
+	const int64 Center = Windows[InWindowIndices[InWindowIndices.Num() / 2]].StartTicks;
+
+	TArray<int32> LeftIndices;
+	TArray<int32> RightIndices;
+	TArray<int32> Overlapping;
+
+	for (const int32 Index : InWindowIndices)
+	{
+		const FWindow& Window = Windows[Index];
+		if (Window.EndTicks <= Center)
+		{
+			LeftIndices.Emplace(Index);
+		}
+		else if (Window.StartTicks > Center)
+		{
+			RightIndices.Emplace(Index);
+		}
+		else
+		{
+			// 시작 시각 오름차순 유지
+			Overlapping.Emplace(Index);
+		}
+	}
+
+	const int32 NodeIndex = Nodes.AddDefaulted();
+	Nodes[NodeIndex].Center = Center;
+	Nodes[NodeIndex].First = ByStart.Num();
+	Nodes[NodeIndex].Num = Overlapping.Num();
+
+	ByStart.Append(Overlapping);
+	Overlapping.Sort([this](const int32 A, const int32 B) { return Windows[A].EndTicks > Windows[B].EndTicks; });
+	ByEnd.Append(Overlapping);
+
+	// 자식 구성 중 Nodes 재할당 가능 → 인덱스로 접근
+	const int32 Left = BuildNode(LeftIndices);
+	const int32 Right = BuildNode(RightIndices);
+	Nodes[NodeIndex].Left = Left;
+	Nodes[NodeIndex].Right = Right;
+
+	return NodeIndex;
+}
+
+void FGachaBannerSchedule::GetActiveCampaigns(const FDateTime& InTime, TArray<const FCompiledGachaCampaign*>& OutCampaigns) const
+{
+	const int64 Ticks = InTime.GetTicks();
+
+	for (int32 NodeIndex = RootNode; NodeIndex != INDEX_NONE;)
+	{
+		const FNode& Node = Nodes[NodeIndex];
+		const int32 Last = Node.First + Node.Num;
+
+		if (Ticks < Node.Center)
+		{
+			for (int32 Index = Node.First; Index < Last && Windows[ByStart[Index]].StartTicks <= Ticks; ++Index)
+			{
+				OutCampaigns.Emplace(Windows[ByStart[Index]].Campaign);
+			}
+			NodeIndex = Node.Left;
+		}
+		else
+		{
+			for (int32 Index = Node.First; Index < Last && Windows[ByEnd[Index]].EndTicks > Ticks; ++Index)
+			{
+				OutCampaigns.Emplace(Windows[ByEnd[Index]].Campaign);
+			}
+			NodeIndex = Node.Right;
+		}
+	}
+}
+
+const FCompiledGachaCampaign* FGachaBannerSchedule::FindActiveCampaign(const FName& InRewardGroupRowName, const FDateTime& InTime) const
+{
+	const int64 Ticks = InTime.GetTicks();
+
+	for (auto It = WindowsByRewardGroup.CreateConstKeyIterator(InRewardGroupRowName); It; ++It)
+	{
+		const FWindow& Window = Windows[It.Value()];
+		if (Window.StartTicks <= Ticks && Ticks < Window.EndTicks)
+		{
+			return Window.Campaign;
+		}
+	}
+	return nullptr;
+}
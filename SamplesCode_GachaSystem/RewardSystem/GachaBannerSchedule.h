@@ -0,0 +1,128 @@
+/**
+ * Gacha Banner Schedule
+ *
+ * 주요 기능:
+ * - 캠페인(배너)별 판매 기간 인덱스
+ * - 특정 시각에 활성화된 배너 조회 (O(log n + k))
+ *
+ * 기술 하이라이트:
+ * - 중심 구간 트리(Centered Interval Tree)를 평탄한 배열로 구성
+ * - 일정 테이블에 없는 캠페인은 상시 판매로 처리
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataTable.h"
+#include "Engine/DeveloperSettings.h"
+#include "GachaBannerSchedule.generated.h"
+
+/**
+ * 배너 판매 기간 (행 이름 = 캠페인 행 이름)
+ * [StartTime, EndTime) 구간, UTC 기준
+ */
+USTRUCT(BlueprintType)
+struct FGachaBannerScheduleRow : public FTableRowBase
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	FDateTime StartTime;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	FDateTime EndTime;
+};
+
+/**
+ * 배너 일정 설정 (Project Settings > Game > Gacha Banner Schedule)
+ */
+UCLASS(config = Game, defaultconfig, meta = (DisplayName = "Gacha Banner Schedule"))
+class UGachaBannerScheduleSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	// FGachaBannerScheduleRow 테이블
+	UPROPERTY(config, EditAnywhere)
+	TSoftObjectPtr<UDataTable> ScheduleTable;
+};
+
+/**
+ * 컴파일된 캠페인 (피티 설정 사본)
+ */
+struct FCompiledGachaCampaign
+{
+	FName RowName;
+	FName RewardGroupRowName;
+	int32 NormalPickupGroup = 0;
+	int32 SpecialPickupGroup = 0;
+	int32 SpecialTryCount = 0;
+
+	// 판매 기간 [StartTicks, EndTicks) (일정 없으면 상시)
+	int64 StartTicks = FDateTime::MinValue().GetTicks();
+	int64 EndTicks = FDateTime::MaxValue().GetTicks();
+};
+
+/**
+ * 배너 일정 인덱스
+ * FRewardDataSnapshot에 포함되어 스냅샷과 함께 교체
+ */
+class FGachaBannerSchedule
+{
+public:
+	/**
+	 * 인덱스 구성
+	 * @param InCampaigns 스냅샷 소유 캠페인 배열 (인덱스 수명 동안 재할당 금지)
+	 */
+	void Build(const TArray<FCompiledGachaCampaign>& InCampaigns);
+
+	/**
+	 * 일정 테이블의 판매 기간을 캠페인에 반영 (FGachaBannerScheduleRow, 잘못된 기간이면 false)
+	 */
+	static bool ApplyScheduleRow(const UDataTable* InScheduleTable, FCompiledGachaCampaign& InOutCampaign);
+
+	/**
+	 * InTime에 판매 중인 캠페인 수집 (O(log n + k))
+	 */
+	void GetActiveCampaigns(const FDateTime& InTime, TArray<const FCompiledGachaCampaign*>& OutCampaigns) const;
+
+	/**
+	 * 보상 그룹에 연결된 캠페인 중 InTime에 판매 중인 캠페인 (없으면 nullptr)
+	 */
+	const FCompiledGachaCampaign* FindActiveCampaign(const FName& InRewardGroupRowName, const FDateTime& InTime) const;
+
+private:
+	struct FWindow
+	{
+		const FCompiledGachaCampaign* Campaign = nullptr;
+		int64 StartTicks = 0;
+		int64 EndTicks = 0;
+	};
+
+	/**
+	 * 구간 트리 노드
+	 * Center를 포함하는 구간만 보관, 나머지는 좌/우 자식으로
+	 */
+	struct FNode
+	{
+		int64 Center = 0;
+		int32 Left = INDEX_NONE;
+		int32 Right = INDEX_NONE;
+
+		// ByStart/ByEnd 내 이 노드 구간 범위
+		int32 First = 0;
+		int32 Num = 0;
+	};
+
+	int32 BuildNode(TArray<int32>& InWindowIndices);
+
+	TArray<FWindow> Windows;
+	TArray<FNode> Nodes;
+	int32 RootNode = INDEX_NONE;
+
+	// 노드별로 시작 시각 오름차순 / 종료 시각 내림차순 정렬된 Window 인덱스
+	TArray<int32> ByStart;
+	TArray<int32> ByEnd;
+
+	TMultiMap<FName, int32> WindowsByRewardGroup;
+};
@@ -0,0 +1,21 @@
+/**
+ * Packed Reward
+ *
+ * 보상 지급 파이프라인 내부용 고정 크기 보상 레코드 (RewardCore/PackedReward.h)
+ * - FName 대신 스냅샷 행/이름 ID 사용
+ * - FRewardHandler 변환은 FRewardDataSnapshot::Pack / Unpack (외부 API 경계에서만)
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RewardCore/PackedReward.h"
+
+/**
+ * 보상 행 ID (스냅샷 로드 시 테이블별 0부터 연속 할당, 스냅샷 교체 시 재할당)
+ * EReward::RewardData → 보상 테이블, EReward::Item → 아이템 테이블 기준
+ */
+using FRewardRowId = RewardCore::FRowId;
+constexpr FRewardRowId InvalidRewardRowId = RewardCore::InvalidRowId;
+
+using FPackedReward = RewardCore::FPackedReward;
@@ -0,0 +1,86 @@
+/**
+ * Reward Allocation Tags Implementation
+ */
+
+#include "RewardAllocTags.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+LLM_DEFINE_TAG(RewardGrant);
+LLM_DEFINE_TAG(RewardInventory);
+
+FName FRewardAllocTags::GetTagName(const RewardCore::EAllocTag InTag)
+{
+	switch (InTag)
+	{
+	case RewardCore::EAllocTag::Reward:		return TEXT("RewardGrant");
+	case RewardCore::EAllocTag::Inventory:	return TEXT("RewardInventory");
+	case RewardCore::EAllocTag::Video:		return TEXT("VideoPlayer");
+	case RewardCore::EAllocTag::Subtitle:	return TEXT("VideoSubtitle");
+	default:								return NAME_None;
+	}
+}
+
+FRewardAllocTagBytes FRewardAllocTags::GetTagBytes(const RewardCore::EAllocTag InTag)
+{
+	FRewardAllocTagBytes Result;
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+	const FName TagName = GetTagName(InTag);
+	if (TagName.IsNone() || !FLowLevelMemTracker::IsEnabled())
+	{
+		return Result;
+	}
+
+	FLowLevelMemTracker& Tracker = FLowLevelMemTracker::Get();
+	Result.Bytes = Tracker.GetTagAmountForTracker(ELLMTracker::Default, TagName, ELLMTagSet::None, UE::LLM::ESizeParams::ReportCurrent);
+	Result.PeakBytes = Tracker.GetTagAmountForTracker(ELLMTracker::Default, TagName, ELLMTagSet::None, UE::LLM::ESizeParams::ReportPeak);
+#endif
+
+	return Result;
+}
+
+FString FRewardAllocTags::Dump()
+{
+	const int32 FirstTag = static_cast<int32>(RewardCore::EAllocTag::Reward);
+	const int32 NumTags = static_cast<int32>(RewardCore::EAllocTag::Num);
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+	const bool bLLMEnabled = FLowLevelMemTracker::IsEnabled();
+#else
+	const bool bLLMEnabled = false;
+#endif
+
+	FString Json = FString::Printf(TEXT("{\n\t\"schema\": \"reward-alloc-stats/1\",\n\t\"llm_enabled\": %s,\n\t\"tags\": [\n"),
+		bLLMEnabled ? TEXT("true") : TEXT("false"));
+	for (int32 Tag = FirstTag; Tag < NumTags; ++Tag)
+	{
+		const FName TagName = GetTagName(static_cast<RewardCore::EAllocTag>(Tag));
+		const FRewardAllocTagBytes TagBytes = GetTagBytes(static_cast<RewardCore::EAllocTag>(Tag));
+
+		Json += FString::Printf(TEXT("\t\t{ \"name\": \"%s\", \"bytes\": %lld, \"peak_bytes\": %lld }%s\n"),
+			*TagName.ToString(), TagBytes.Bytes, TagBytes.PeakBytes,
+			Tag + 1 < NumTags ? TEXT(",") : TEXT(""));
+
+		// 로그 : [RewardAlloc] %-16s bytes=%lld peak=%lld
+	}
+	Json += TEXT("\t]\n}\n");
+
+	const FString OutPath = FPaths::ProjectSavedDir() / TEXT("Profiling/RewardAllocStats.json");
+	FFileHelper::SaveStringToFile(Json, *OutPath);
+	// 로그 : [RewardAlloc] Wrote %s
+
+	return Json;
+}
+
+namespace RewardAllocTags
+{
+	static FAutoConsoleCommand AllocStatsCommand(
+		TEXT("Reward.AllocStats"),
+		TEXT("Log current and peak LLM bytes of the reward, inventory, video and subtitle allocation tags and write Saved/Profiling/RewardAllocStats.json (requires -LLM)."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			FRewardAllocTags::Dump();
+		}));
+}
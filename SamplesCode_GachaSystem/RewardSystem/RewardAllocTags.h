@@ -0,0 +1,43 @@
+/**
+ * Reward Allocation Tags
+ *
+ * 서브시스템별 할당 추적 (LLM 태그, RewardCore EAllocTag와 1:1)
+ * - Reward → RewardGrant, Inventory → RewardInventory (보상 모듈에서 정의)
+ * - Video → VideoPlayer, Subtitle → VideoSubtitle (VideoPlayer 모듈에서 정의, 조회는 이름으로)
+ * - 런타임 조회 : Reward.AllocStats 콘솔 (현재/최대 바이트, Saved/Profiling/RewardAllocStats.json), stat LLMFULL
+ * - 할당 횟수는 LLM에서 제공하지 않음 → 케이스별 allocs/op는 RewardBench / VideoPlayer.BenchSubtitle 결과 사용
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "RewardCore/AllocationStats.h"
+
+LLM_DECLARE_TAG(RewardGrant);
+LLM_DECLARE_TAG(RewardInventory);
+
+struct FRewardAllocTagBytes
+{
+	int64 Bytes = 0;
+	int64 PeakBytes = 0;
+};
+
+class FRewardAllocTags
+{
+public:
+	/**
+	 * LLM 태그 이름 (LLM_DEFINE_TAG 이름과 동일)
+	 */
+	static FName GetTagName(const RewardCore::EAllocTag InTag);
+
+	/**
+	 * 현재/최대 바이트 (LLM 비활성 시 0, -LLM 실행 인자 필요)
+	 */
+	static FRewardAllocTagBytes GetTagBytes(const RewardCore::EAllocTag InTag);
+
+	/**
+	 * 태그별 현재/최대 바이트를 JSON으로 저장 (Saved/Profiling/RewardAllocStats.json)
+	 */
+	static FString Dump();
+};
@@ -0,0 +1,45 @@
+/**
+ * RewardCore Adapters Implementation
+ */
+
+#include "RewardCoreAdapters.h"
+#include "RewardDataSnapshot.h"
+#include "Network/UserData_Inventory.h"
+#include "SaveGame/ContentsAlarmSave.h"
+#include <atomic>
+
+/**
+ * 시드 = 사이클 카운터 ^ 프로세스 내 순번 (동시 생성 시에도 시드 중복 방지)
+ */
+FEngineRewardRandom::FEngineRewardRandom()
+{
+	static std::atomic<uint64> Sequence{ 0 };
+	const uint64 Index = Sequence.fetch_add(1, std::memory_order_relaxed);
+	Random.Seed(FPlatformTime::Cycles64() ^ (Index * 0x9E3779B97F4A7C15ull));
+}
+
+void FContentsAlarmPityStore::LoadPity(const RewardCore::FRowId InRewardId, RewardCore::FPityState& OutState)
+{
+	OutState = RewardCore::FPityState();
+	UContentsAlarmSave::GetGachaCounter(Snapshot.GetRewardName(InRewardId), OutState.NormalCounter, OutState.SpecialCounter);
+}
+
+void FContentsAlarmPityStore::SavePity(const RewardCore::FRowId InRewardId, const RewardCore::FPityState& InState)
+{
+	UContentsAlarmSave::SetGachaCounter(Snapshot.GetRewardName(InRewardId), InState.NormalCounter, InState.SpecialCounter);
+}
+
+int32 FUserInventoryView::GetItemSlotCount() const
+{
+	return UUserData_Inventory::GetItemSlotCount();
+}
+
+int32 FUserInventoryView::GetMaxCapacity() const
+{
+	return UUserData_Inventory::GetMaxCapacity();
+}
+
+int32 FUserInventoryView::GetAmount(const RewardCore::FRowId InItemId) const
+{
+	return UUserData_Inventory::GetAmount(Snapshot.GetItemName(InItemId));
+}
@@ -0,0 +1,58 @@
+/**
+ * RewardCore Adapters
+ *
+ * 엔진 비의존 코어(RewardCore/)의 인터페이스를 UE 시스템에 연결
+ * - 난수 : 호출마다 새 시드의 FDefaultRandom (시드/생성 위치로 트래픽 재현)
+ * - 피티 저장소 : UContentsAlarmSave (보상 그룹 이름 기준)
+ * - 인벤토리 조회 : UUserData_Inventory (아이템 이름 기준)
+ *
+ * 보상/아이템 데이터는 FRewardDataSnapshot이 직접 RewardCore::IRewardData 구현
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RewardCore/DefaultRandom.h"
+#include "RewardCore/Interfaces.h"
+#include "RewardCore/PityStateMachine.h"
+
+class FRewardDataSnapshot;
+
+class FEngineRewardRandom final : public RewardCore::IRandom
+{
+public:
+	FEngineRewardRandom();
+
+	virtual int32 RandRange(const int32 InMin, const int32 InMax) override { return Random.RandRange(InMin, InMax); }
+
+	uint64 GetSeed() const { return Random.GetSeed(); }
+	uint64 GetCounter() const { return Random.GetCounter(); }
+
+private:
+	RewardCore::FDefaultRandom Random;
+};
+
+class FContentsAlarmPityStore final : public RewardCore::IPityStore
+{
+public:
+	explicit FContentsAlarmPityStore(const FRewardDataSnapshot& InSnapshot) : Snapshot(InSnapshot) {}
+
+	virtual void LoadPity(const RewardCore::FRowId InRewardId, RewardCore::FPityState& OutState) override;
+	virtual void SavePity(const RewardCore::FRowId InRewardId, const RewardCore::FPityState& InState) override;
+
+private:
+	const FRewardDataSnapshot& Snapshot;
+};
+
+class FUserInventoryView final : public RewardCore::IInventoryView
+{
+public:
+	explicit FUserInventoryView(const FRewardDataSnapshot& InSnapshot) : Snapshot(InSnapshot) {}
+
+	virtual int32 GetItemSlotCount() const override;
+	virtual int32 GetMaxCapacity() const override;
+	virtual int32 GetAmount(const RewardCore::FRowId InItemId) const override;
+
+private:
+	const FRewardDataSnapshot& Snapshot;
+};
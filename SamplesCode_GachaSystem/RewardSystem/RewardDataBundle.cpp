@@ -0,0 +1,512 @@
+/**
+ * Reward Data Bundle Implementation
+ *
+ * 완전 해시 (Hash and Displace):
+ * - 1단계 : Hash(Name, 0) % BucketNum → 버킷
+ * - 2단계 : Hash(Name, Seeds[버킷]) % SlotNum → 슬롯 (쿡 시 충돌 없는 Seed 탐색)
+ * - 슬롯 → 행 인덱스, 행 이름 비교로 미등록 이름 배제
+ *
+ * 인덱스 섹션 : [BucketNum][SlotNum][Seeds x BucketNum][Slots x SlotNum] (모두 uint32)
+ */
+
+#include "RewardDataBundle.h"
+#include "GachaBannerSchedule.h"
+#include "Async/MappedFileHandle.h"
+#include "DataTable/GachaCampaignData.h"
+#include "DataTable/ItemDataTable.h"
+#include "DataTable/RewardData.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+
+namespace RewardBundle
+{
+	constexpr uint32 SectionAlignment = 8;
+	constexpr uint32 EmptySlot = MAX_uint32;
+
+	// 대소문자 무시 (FName 비교 규칙과 동일)
+	uint32 HashName(const ANSICHAR* InName, const int32 InLength, const uint32 InSeed)
+	{
+		uint64 Hash = 0xcbf29ce484222325ull ^ (InSeed * 0x9e3779b97f4a7c15ull);
+		for (int32 Index = 0; Index < InLength; ++Index)
+		{
+			Hash ^= static_cast<uint8>(FCharAnsi::ToLower(InName[Index]));
+			Hash *= 0x100000001b3ull;
+		}
+
+		Hash ^= Hash >> 33;
+		Hash *= 0xff51afd7ed558ccdull;
+		Hash ^= Hash >> 33;
+		return static_cast<uint32>(Hash);
+	}
+
+	uint32 GetRowStride(const ERewardBundleSection InSection)
+	{
+		switch (InSection)
+		{
+		case ERewardBundleSection::Strings:			return 1;
+		case ERewardBundleSection::RewardRows:		return sizeof(FRewardBundleRewardRow);
+		case ERewardBundleSection::RewardHandlers:	return sizeof(FRewardBundleHandler);
+		case ERewardBundleSection::RewardEntries:	return sizeof(FRewardBundleEntry);
+		case ERewardBundleSection::CampaignRows:	return sizeof(FRewardBundleCampaignRow);
+		case ERewardBundleSection::ItemRows:		return sizeof(FRewardBundleItemRow);
+		default:									return sizeof(uint32);
+		}
+	}
+
+	/**
+	 * 번들 작성기 (쿡 전용)
+	 */
+	class FWriter
+	{
+	public:
+		FWriter()
+		{
+			// 오프셋 0 = 빈 문자열
+			Strings.Add('\0');
+		}
+
+		uint32 AddString(const FString& InString)
+		{
+			if (InString.IsEmpty())
+			{
+				return 0;
+			}
+
+			if (const uint32* Offset = StringOffsets.Find(InString))
+			{
+				return *Offset;
+			}
+
+			const FTCHARToUTF8 Utf8(*InString);
+			const uint32 Offset = Strings.Num();
+			Strings.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+			Strings.Add('\0');
+			StringOffsets.Add(InString, Offset);
+			return Offset;
+		}
+
+		uint32 AddName(const FName& InName) { return AddString(InName.IsNone() ? FString() : InName.ToString()); }
+
+		template <typename RowType>
+		void SetRows(const ERewardBundleSection InSection, const TArray<RowType>& InRows)
+		{
+			SetSection(InSection, InRows.GetData(), InRows.Num() * sizeof(RowType), InRows.Num());
+		}
+
+		/**
+		 * 행 이름(행 구조체 첫 필드) 기준 완전 해시 인덱스 구성
+		 */
+		template <typename RowType>
+		void SetIndex(const ERewardBundleSection InIndexSection, const TArray<RowType>& InRows)
+		{
+			const uint32 RowNum = InRows.Num();
+			const uint32 BucketNum = FMath::Max(1u, RowNum / 4);
+			const uint32 SlotNum = FMath::Max(1u, RowNum + RowNum / 4);
+
+			// 버킷 분류
+			TArray<TArray<uint32>> Buckets;
+			Buckets.SetNum(BucketNum);
+			for (uint32 Row = 0; Row < RowNum; ++Row)
+			{
+				Buckets[Hash(InRows[Row].Name, 0) % BucketNum].Emplace(Row);
+			}
+
+			// 큰 버킷부터 Seed 탐색
+			TArray<uint32> BucketOrder;
+			for (uint32 Bucket = 0; Bucket < BucketNum; ++Bucket)
+			{
+				BucketOrder.Emplace(Bucket);
+			}
+			BucketOrder.Sort([&Buckets](const uint32 A, const uint32 B) { return Buckets[A].Num() > Buckets[B].Num(); });
+
+			TArray<uint32> Seeds;
+			Seeds.Init(0, BucketNum);
+			TArray<uint32> Slots;
+			Slots.Init(EmptySlot, SlotNum);
+
+			TArray<uint32> Candidate;
+			for (const uint32 Bucket : BucketOrder)
+			{
+				if (Buckets[Bucket].IsEmpty())
+				{
+					break;
+				}
+
+				for (uint32 Seed = 1;; ++Seed)
+				{
+					Candidate.Reset();
+					bool bCollided = false;
+
+					for (const uint32 Row : Buckets[Bucket])
+					{
+						const uint32 Slot = Hash(InRows[Row].Name, Seed) % SlotNum;
+						if (Slots[Slot] != EmptySlot || Candidate.Contains(Slot))
+						{
+							bCollided = true;
+							break;
+						}
+						Candidate.Emplace(Slot);
+					}
+
+					if (!bCollided)
+					{
+						for (int32 Index = 0; Index < Candidate.Num(); ++Index)
+						{
+							Slots[Candidate[Index]] = Buckets[Bucket][Index];
+						}
+						Seeds[Bucket] = Seed;
+						break;
+					}
+				}
+			}
+
+			TArray<uint32> Index;
+			Index.Reserve(2 + BucketNum + SlotNum);
+			Index.Emplace(BucketNum);
+			Index.Emplace(SlotNum);
+			Index.Append(Seeds);
+			Index.Append(Slots);
+			SetSection(InIndexSection, Index.GetData(), Index.Num() * sizeof(uint32), RowNum);
+		}
+
+		bool Save(const FString& InPath)
+		{
+			SetSection(ERewardBundleSection::Strings, Strings.GetData(), Strings.Num(), Strings.Num());
+
+			constexpr uint32 SectionNum = static_cast<uint32>(ERewardBundleSection::Num);
+
+			TArray64<uint8> Out;
+			Out.AddZeroed(Align(sizeof(FRewardBundleHeader) + sizeof(FRewardBundleSection) * SectionNum, SectionAlignment));
+
+			for (uint32 Index = 0; Index < SectionNum; ++Index)
+			{
+				Sections[Index].Type = Index;
+				Sections[Index].Offset = Out.Num();
+				Sections[Index].Size = SectionData[Index].Num();
+
+				Out.Append(SectionData[Index]);
+				Out.AddZeroed(Align(Out.Num(), SectionAlignment) - Out.Num());
+			}
+
+			FRewardBundleHeader Header;
+			Header.SectionNum = SectionNum;
+			Header.FileSize = Out.Num();
+
+			FMemory::Memcpy(Out.GetData(), &Header, sizeof(Header));
+			FMemory::Memcpy(Out.GetData() + sizeof(Header), Sections, sizeof(Sections));
+
+			return FFileHelper::SaveArrayToFile(Out, *InPath);
+		}
+
+	private:
+		uint32 Hash(const uint32 InNameOffset, const uint32 InSeed) const
+		{
+			const ANSICHAR* Name = reinterpret_cast<const ANSICHAR*>(Strings.GetData() + InNameOffset);
+			return HashName(Name, FCStringAnsi::Strlen(Name), InSeed);
+		}
+
+		void SetSection(const ERewardBundleSection InSection, const void* InData, const int64 InSize, const uint32 InNum)
+		{
+			const uint32 Index = static_cast<uint32>(InSection);
+			SectionData[Index].Reset();
+			SectionData[Index].Append(static_cast<const uint8*>(InData), InSize);
+			Sections[Index].Num = InNum;
+		}
+
+		TArray<uint8> Strings;
+		TMap<FString, uint32> StringOffsets;
+		TArray64<uint8> SectionData[static_cast<uint32>(ERewardBundleSection::Num)];
+		FRewardBundleSection Sections[static_cast<uint32>(ERewardBundleSection::Num)];
+	};
+
+	FRewardBundleHandler MakeHandler(FWriter& InWriter, const FRewardHandler& InHandler)
+	{
+		FRewardBundleHandler Handler;
+		Handler.Name = InWriter.AddName(InHandler.TypeRowName);
+		Handler.RewardType = static_cast<uint8>(InHandler.RewardType);
+		Handler.AcquireSource = static_cast<uint8>(InHandler.AcquireSource);
+		Handler.Amount = InHandler.Amount;
+		return Handler;
+	}
+}
+
+FRewardDataBundle::~FRewardDataBundle()
+{
+	// 영역 → 파일 순서로 해제
+	MappedRegion.Reset();
+	MappedFile.Reset();
+}
+
+/**
+ * 번들 쿡
+ *
+ * 로직:
+ * 1. 테이블별 행을 POD 행 구조체로 변환 (문자열은 풀에 중복 제거 후 오프셋)
+ * 2. 행 이름 기준 완전 해시 인덱스 생성
+ * 3. 섹션 정렬 후 파일 저장
+ */
+bool FRewardDataBundle::Cook(const FString& InPath)
+{
+	using namespace RewardBundle;
+
+	FWriter Writer;
+
+	TArray<FRewardBundleRewardRow> RewardRows;
+	TArray<FRewardBundleHandler> RewardHandlers;
+	TArray<FRewardBundleEntry> RewardEntries;
+	URewardDataTable::Visit([&](const URewardData* Data)
+	{
+		FRewardBundleRewardRow& Row = RewardRows.AddDefaulted_GetRef();
+		Row.Name = Writer.AddName(Data->DataRowName);
+		Row.RewardGroupName = Writer.AddName(Data->RewardGroupName);
+		Row.TotalWeight = Data->TotalWeight;
+		Row.TotalGachaWeight = Data->TotalGachaWeight;
+
+		Row.FirstStatic = RewardHandlers.Num();
+		for (const FRewardHandler& Handler : Data->Statics)
+		{
+			RewardHandlers.Emplace(MakeHandler(Writer, Handler));
+		}
+		Row.StaticNum = RewardHandlers.Num() - Row.FirstStatic;
+
+		Row.FirstRandom = RewardEntries.Num();
+		for (const TObjectPtr<URewardRandomData>& Random : Data->Randoms)
+		{
+			if (Random)
+			{
+				FRewardBundleEntry& Entry = RewardEntries.AddDefaulted_GetRef();
+				Entry.Reward = MakeHandler(Writer, Random->Reward);
+				Entry.Weight = Random->Weight;
+			}
+		}
+		Row.RandomNum = RewardEntries.Num() - Row.FirstRandom;
+
+		Row.FirstGacha = RewardEntries.Num();
+		for (const TObjectPtr<URewardGachaRandomData>& GachaRandom : Data->GachaRandoms)
+		{
+			if (GachaRandom)
+			{
+				FRewardBundleEntry& Entry = RewardEntries.AddDefaulted_GetRef();
+				Entry.Reward = MakeHandler(Writer, GachaRandom->Reward);
+				Entry.Weight = GachaRandom->Weight;
+				Entry.PickupGroup = GachaRandom->PickupGroup;
+			}
+		}
+		Row.GachaNum = RewardEntries.Num() - Row.FirstGacha;
+	});
+
+	// 캠페인 : 배너 일정 포함
+	const UDataTable* ScheduleTable = GetDefault<UGachaBannerScheduleSettings>()->ScheduleTable.LoadSynchronous();
+	TArray<FRewardBundleCampaignRow> CampaignRows;
+	UGachaCampaignDataTable::Visit([&](const FGachaCampaignData* Data)
+	{
+		FCompiledGachaCampaign Campaign;
+		Campaign.RowName = Data->DataRowName;
+		if (!FGachaBannerSchedule::ApplyScheduleRow(ScheduleTable, Campaign))
+		{
+			return;
+		}
+
+		FRewardBundleCampaignRow& Row = CampaignRows.AddDefaulted_GetRef();
+		Row.Name = Writer.AddName(Data->DataRowName);
+		Row.RewardGroupRowName = Writer.AddName(Data->RewardGroupRowName);
+		Row.NormalPickupGroup = Data->NormalPickupGroup;
+		Row.SpecialPickupGroup = Data->SpecialPickupGroup;
+		Row.SpecialTryCount = Data->SpecialTryCount;
+		Row.StartTicks = Campaign.StartTicks;
+		Row.EndTicks = Campaign.EndTicks;
+	});
+
+	TArray<FRewardBundleItemRow> ItemRows;
+	UItemDataTable::Visit([&](const FItemBaseData* Data)
+	{
+		FRewardBundleItemRow& Row = ItemRows.AddDefaulted_GetRef();
+		Row.Name = Writer.AddName(Data->DataRowName);
+		Row.ItemID = Data->ItemID;
+		Row.MaxStackAmount = Data->MaxStackAmount;
+		Row.bNonStackable = Data->IsNonStackable();
+		Row.bRequiresInventorySlot = Data->RequiresInventorySlot();
+	});
+
+	Writer.SetRows(ERewardBundleSection::RewardRows, RewardRows);
+	Writer.SetRows(ERewardBundleSection::RewardHandlers, RewardHandlers);
+	Writer.SetRows(ERewardBundleSection::RewardEntries, RewardEntries);
+	Writer.SetRows(ERewardBundleSection::CampaignRows, CampaignRows);
+	Writer.SetRows(ERewardBundleSection::ItemRows, ItemRows);
+
+	Writer.SetIndex(ERewardBundleSection::RewardIndex, RewardRows);
+	Writer.SetIndex(ERewardBundleSection::CampaignIndex, CampaignRows);
+	Writer.SetIndex(ERewardBundleSection::ItemIndex, ItemRows);
+
+	// 로그 : [RewardBundle] Cooked %s (Rewards %d, Items %d, Campaigns %d)
+	return Writer.Save(InPath);
+}
+
+/**
+ * 번들 로드
+ * 메모리 맵으로 열고 헤더/섹션 범위만 검증 (행 단위 변환 없음)
+ */
+TSharedPtr<const FRewardDataBundle> FRewardDataBundle::Load(const FString& InPath)
+{
+	TSharedPtr<FRewardDataBundle> Bundle = MakeShared<FRewardDataBundle>();
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	Bundle->MappedFile.Reset(PlatformFile.OpenMapped(*InPath));
+	if (Bundle->MappedFile)
+	{
+		Bundle->MappedRegion.Reset(Bundle->MappedFile->MapRegion(0, Bundle->MappedFile->GetFileSize()));
+	}
+
+	if (Bundle->MappedRegion)
+	{
+		Bundle->Data = Bundle->MappedRegion->GetMappedPtr();
+		Bundle->Size = Bundle->MappedRegion->GetMappedSize();
+	}
+	else if (FFileHelper::LoadFileToArray(Bundle->FileData, *InPath))
+	{
+		Bundle->Data = Bundle->FileData.GetData();
+		Bundle->Size = Bundle->FileData.Num();
+	}
+
+	if (!Bundle->Data || !Bundle->Validate())
+	{
+		// 로그 : [RewardBundle] Invalid bundle %s
+		return nullptr;
+	}
+
+	// 로그 : [RewardBundle] Loaded %s (%lld bytes, mapped=%d)
+	return Bundle;
+}
+
+FString FRewardDataBundle::GetCommandLinePath()
+{
+	FString Path;
+	FParse::Value(FCommandLine::Get(), TEXT("RewardBundle="), Path);
+	return Path;
+}
+
+bool FRewardDataBundle::Validate()
+{
+	using namespace RewardBundle;
+
+	constexpr uint32 SectionNum = static_cast<uint32>(ERewardBundleSection::Num);
+	if (Size < static_cast<int64>(sizeof(FRewardBundleHeader) + sizeof(Sections)))
+	{
+		return false;
+	}
+
+	const FRewardBundleHeader* Header = reinterpret_cast<const FRewardBundleHeader*>(Data);
+	if (Header->Magic != FRewardBundleHeader::MagicValue
+		|| Header->Version != FRewardBundleHeader::CurrentVersion
+		|| Header->SectionNum != SectionNum
+		|| Header->FileSize != static_cast<uint64>(Size))
+	{
+		return false;
+	}
+
+	FMemory::Memcpy(Sections, Data + sizeof(FRewardBundleHeader), sizeof(Sections));
+
+	for (uint32 Index = 0; Index < SectionNum; ++Index)
+	{
+		const FRewardBundleSection& Section = Sections[Index];
+		const ERewardBundleSection Type = static_cast<ERewardBundleSection>(Index);
+
+		if (Section.Type != Index || Section.Offset % SectionAlignment != 0 || Section.Offset + Section.Size > static_cast<uint64>(Size))
+		{
+			return false;
+		}
+
+		// 행 섹션 : 크기 = 행 수 x 구조체 크기
+		if (Type < ERewardBundleSection::RewardIndex && Section.Size != static_cast<uint64>(Section.Num) * GetRowStride(Type))
+		{
+			return false;
+		}
+
+		// 인덱스 섹션 : 헤더 + Seeds + Slots
+		if (Type >= ERewardBundleSection::RewardIndex)
+		{
+			const uint32* Index32 = reinterpret_cast<const uint32*>(Data + Section.Offset);
+			if (Section.Size < sizeof(uint32) * 2 || Index32[0] == 0 || Index32[1] == 0
+				|| Section.Size != sizeof(uint32) * (2ull + Index32[0] + Index32[1]))
+			{
+				return false;
+			}
+		}
+	}
+
+	const FRewardBundleSection& Strings = Sections[static_cast<uint32>(ERewardBundleSection::Strings)];
+	if (Strings.Size == 0 || Data[Strings.Offset + Strings.Size - 1] != '\0')
+	{
+		return false;
+	}
+
+	// 보상 행의 하위 범위 검증 (메모리 맵 영역 밖 접근 방지)
+	const uint32 HandlerNum = Sections[static_cast<uint32>(ERewardBundleSection::RewardHandlers)].Num;
+	const uint32 EntryNum = Sections[static_cast<uint32>(ERewardBundleSection::RewardEntries)].Num;
+	for (const FRewardBundleRewardRow& Row : GetRows<FRewardBundleRewardRow>(ERewardBundleSection::RewardRows))
+	{
+		if (static_cast<uint64>(Row.FirstStatic) + Row.StaticNum > HandlerNum
+			|| static_cast<uint64>(Row.FirstRandom) + Row.RandomNum > EntryNum
+			|| static_cast<uint64>(Row.FirstGacha) + Row.GachaNum > EntryNum)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+const ANSICHAR* FRewardDataBundle::GetString(const uint32 InOffset) const
+{
+	const FRewardBundleSection& Strings = Sections[static_cast<uint32>(ERewardBundleSection::Strings)];
+	return reinterpret_cast<const ANSICHAR*>(Data + Strings.Offset + (InOffset < Strings.Size ? InOffset : 0));
+}
+
+int32 FRewardDataBundle::FindRowIndex(const ERewardBundleSection InIndexSection, const FName& InRowName, const ERewardBundleSection InRowSection, const uint32 InRowStride) const
+{
+	using namespace RewardBundle;
+
+	TStringBuilder<FName::StringBufferSize> NameBuilder;
+	InRowName.AppendString(NameBuilder);
+	const FTCHARToUTF8 Utf8(NameBuilder.ToString(), NameBuilder.Len());
+
+	const uint32* Index = reinterpret_cast<const uint32*>(Data + Sections[static_cast<uint32>(InIndexSection)].Offset);
+	const uint32 BucketNum = Index[0];
+	const uint32 SlotNum = Index[1];
+	const uint32* Seeds = Index + 2;
+	const uint32* Slots = Seeds + BucketNum;
+
+	const uint32 Seed = Seeds[HashName(Utf8.Get(), Utf8.Length(), 0) % BucketNum];
+	const uint32 Row = Slots[HashName(Utf8.Get(), Utf8.Length(), Seed) % SlotNum];
+
+	const FRewardBundleSection& RowSection = Sections[static_cast<uint32>(InRowSection)];
+	if (Row == EmptySlot || Row >= RowSection.Num)
+	{
+		return INDEX_NONE;
+	}
+
+	// 행 구조체 첫 필드 = 이름 오프셋
+	const uint32 NameOffset = *reinterpret_cast<const uint32*>(Data + RowSection.Offset + static_cast<uint64>(Row) * InRowStride);
+	const ANSICHAR* RowName = GetString(NameOffset);
+	if (FCStringAnsi::Strnicmp(RowName, Utf8.Get(), Utf8.Length()) != 0 || RowName[Utf8.Length()] != '\0')
+	{
+		return INDEX_NONE;
+	}
+	return static_cast<int32>(Row);
+}
+
+const FRewardBundleRewardRow* FRewardDataBundle::FindReward(const FName& InRowName) const
+{
+	return FindRow<FRewardBundleRewardRow>(ERewardBundleSection::RewardIndex, ERewardBundleSection::RewardRows, InRowName);
+}
+
+const FRewardBundleCampaignRow* FRewardDataBundle::FindCampaign(const FName& InRowName) const
+{
+	return FindRow<FRewardBundleCampaignRow>(ERewardBundleSection::CampaignIndex, ERewardBundleSection::CampaignRows, InRowName);
+}
+
+const FRewardBundleItemRow* FRewardDataBundle::FindItem(const FName& InRowName) const
+{
+	return FindRow<FRewardBundleItemRow>(ERewardBundleSection::ItemIndex, ERewardBundleSection::ItemRows, InRowName);
+}
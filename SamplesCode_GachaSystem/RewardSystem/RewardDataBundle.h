@@ -0,0 +1,178 @@
+/**
+ * Reward Data Bundle
+ *
+ * 주요 기능:
+ * - 보상/캠페인/아이템 테이블을 하나의 평탄한 바이너리로 쿡 (보상 서버 경로에서 읽는 필드만)
+ * - 런타임은 파일을 메모리 맵으로 열어 그대로 사용 (행 단위 객체 생성 없음)
+ * - 테이블별 완전 해시(Perfect Hash) 행 인덱스
+ *
+ * 파일 레이아웃 (리틀 엔디언, 섹션 8바이트 정렬):
+ * [FRewardBundleHeader][FRewardBundleSection x SectionNum][섹션 데이터...]
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * 섹션 종류
+ */
+enum class ERewardBundleSection : uint32
+{
+	Strings,			// UTF-8 문자열 풀 (null 종료)
+	RewardRows,			// FRewardBundleRewardRow
+	RewardHandlers,		// FRewardBundleHandler (Statics)
+	RewardEntries,		// FRewardBundleEntry (Randoms, GachaRandoms)
+	CampaignRows,		// FRewardBundleCampaignRow
+	ItemRows,			// FRewardBundleItemRow
+	RewardIndex,		// 완전 해시 인덱스 (이하 동일)
+	CampaignIndex,
+	ItemIndex,
+
+	Num
+};
+
+struct FRewardBundleHeader
+{
+	static constexpr uint32 MagicValue = 0x42445752;	// 'RWDB'
+	static constexpr uint32 CurrentVersion = 2;
+
+	uint32 Magic = MagicValue;
+	uint32 Version = CurrentVersion;
+	uint32 SectionNum = 0;
+	uint32 Reserved = 0;
+	uint64 FileSize = 0;
+};
+
+struct FRewardBundleSection
+{
+	uint32 Type = 0;
+	uint32 Num = 0;			// 요소 수
+	uint64 Offset = 0;		// 파일 시작 기준
+	uint64 Size = 0;		// 바이트
+};
+
+// 이하 행 구조체의 문자열은 모두 Strings 섹션 오프셋
+
+struct FRewardBundleHandler
+{
+	uint32 Name = 0;
+	uint8 RewardType = 0;
+	uint8 AcquireSource = 0;
+	uint16 Padding = 0;
+	int32 Amount = 0;
+};
+
+struct FRewardBundleEntry
+{
+	FRewardBundleHandler Reward;
+	int32 Weight = 0;
+	int32 PickupGroup = 0;
+};
+
+struct FRewardBundleRewardRow
+{
+	uint32 Name = 0;
+	uint32 RewardGroupName = 0;
+	int32 TotalWeight = 0;
+	int32 TotalGachaWeight = 0;
+
+	// RewardHandlers / RewardEntries 내 범위
+	uint32 FirstStatic = 0;
+	uint32 StaticNum = 0;
+	uint32 FirstRandom = 0;
+	uint32 RandomNum = 0;
+	uint32 FirstGacha = 0;
+	uint32 GachaNum = 0;
+};
+
+struct FRewardBundleCampaignRow
+{
+	uint32 Name = 0;
+	uint32 RewardGroupRowName = 0;
+	int32 NormalPickupGroup = 0;
+	int32 SpecialPickupGroup = 0;
+	int32 SpecialTryCount = 0;
+	uint32 Padding = 0;
+	int64 StartTicks = 0;
+	int64 EndTicks = 0;
+};
+
+struct FRewardBundleItemRow
+{
+	uint32 Name = 0;
+	int32 ItemID = 0;
+	int32 MaxStackAmount = 0;
+	uint8 bNonStackable = 0;
+	uint8 bRequiresInventorySlot = 0;
+	uint16 Padding = 0;
+};
+
+/**
+ * 메모리 맵 번들
+ *
+ * 사용법:
+ *   TSharedPtr<const FRewardDataBundle> Bundle = FRewardDataBundle::Load(Path);
+ *   const FRewardBundleItemRow* Item = Bundle->FindItem(RowName);
+ */
+class FRewardDataBundle
+{
+public:
+	~FRewardDataBundle();
+
+	/**
+	 * 현재 데이터 테이블을 번들로 쿡 (에디터/쿡 커맨드렛)
+	 */
+	static bool Cook(const FString& InPath);
+
+	/**
+	 * 번들 로드 (메모리 맵 불가 시 파일 전체 읽기)
+	 * @return 버전/섹션 검증 실패 시 nullptr
+	 */
+	static TSharedPtr<const FRewardDataBundle> Load(const FString& InPath);
+
+	/**
+	 * 서버 실행 인자 -RewardBundle=<경로> (없으면 빈 문자열)
+	 */
+	static FString GetCommandLinePath();
+
+	template <typename RowType>
+	TConstArrayView<RowType> GetRows(const ERewardBundleSection InSection) const
+	{
+		const FRewardBundleSection& Section = Sections[static_cast<uint32>(InSection)];
+		return MakeArrayView(reinterpret_cast<const RowType*>(Data + Section.Offset), static_cast<int32>(Section.Num));
+	}
+
+	const ANSICHAR* GetString(const uint32 InOffset) const;
+	FName GetName(const uint32 InOffset) const { return FName(FUTF8ToTCHAR(GetString(InOffset)).Get()); }
+
+	const FRewardBundleRewardRow* FindReward(const FName& InRowName) const;
+	const FRewardBundleCampaignRow* FindCampaign(const FName& InRowName) const;
+	const FRewardBundleItemRow* FindItem(const FName& InRowName) const;
+
+private:
+	bool Validate();
+
+	/**
+	 * 완전 해시 조회 → 행 인덱스 (없으면 INDEX_NONE)
+	 */
+	int32 FindRowIndex(const ERewardBundleSection InIndexSection, const FName& InRowName, const ERewardBundleSection InRowSection, const uint32 InRowStride) const;
+
+	template <typename RowType>
+	const RowType* FindRow(const ERewardBundleSection InIndexSection, const ERewardBundleSection InRowSection, const FName& InRowName) const
+	{
+		const int32 Index = FindRowIndex(InIndexSection, InRowName, InRowSection, sizeof(RowType));
+		return Index != INDEX_NONE ? &GetRows<RowType>(InRowSection)[Index] : nullptr;
+	}
+
+	TUniquePtr<IMappedFileHandle> MappedFile;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+	TArray64<uint8> FileData;
+
+	const uint8* Data = nullptr;
+	int64 Size = 0;
+	FRewardBundleSection Sections[static_cast<uint32>(ERewardBundleSection::Num)];
+};
@@ -0,0 +1,460 @@
+/**
+ * Reward Data Snapshot Implementation
+ *
+ * RCU 동작:
+ * - 읽기 : Epoch 읽기 → 해당 짝/홀 카운터 증가 → Epoch 재확인 → 포인터 읽기
+ * - 교체 : 포인터 교체 → Epoch 증가 → 이전 짝/홀 카운터가 0이 될 때까지 대기 → 이전 스냅샷 해제
+ *
+ * Epoch 재확인으로 교체 도중 증가한 읽기는 새 Epoch로 재시도하므로
+ * 이전 카운터가 0이 되면 이전 포인터를 가진 읽기는 남아 있지 않음
+ */
+
+#include "RewardDataSnapshot.h"
+#include "RewardDataBundle.h"
+#include "DataTable/GachaCampaignData.h"
+#include "DataTable/ItemDataTable.h"
+#include "DataTable/RewardData.h"
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+#include <atomic>
+
+/**
+ * 코어가 보상 종류를 판단하는 플래그 (EReward 원본 값과 분리)
+ */
+static uint8 GetRewardKindFlags(const EReward InRewardType)
+{
+	switch (InRewardType)
+	{
+	case EReward::RewardData:	return FPackedReward::Bundle;
+	case EReward::Item:			return FPackedReward::Item;
+	default:					return 0;
+	}
+}
+
+namespace RewardSnapshot
+{
+	std::atomic<FRewardDataSnapshot*> Current{ nullptr };
+	std::atomic<uint64> Epoch{ 0 };
+	std::atomic<int32> Readers[2]{ { 0 }, { 0 } };
+
+	// 교체 측 직렬화 (읽기 측은 사용하지 않음)
+	FCriticalSection PublishLock;
+	uint64 NextVersion = 1;
+
+	FSimpleMulticastDelegate Published;
+
+	FAutoConsoleCommand ReloadCommand(
+		TEXT("Reward.ReloadSnapshot"),
+		TEXT("Recompile reward/campaign/item tables into a new snapshot and publish it"),
+		FConsoleCommandDelegate::CreateStatic(&FRewardDataSnapshot::Rebuild));
+}
+
+FRewardSnapshotPin::FRewardSnapshotPin()
+{
+	for (;;)
+	{
+		const uint64 PinnedEpoch = RewardSnapshot::Epoch.load();
+		ReaderSlot = static_cast<uint32>(PinnedEpoch & 1);
+		RewardSnapshot::Readers[ReaderSlot].fetch_add(1);
+
+		// 교체 중 → 새 Epoch로 재시도
+		if (RewardSnapshot::Epoch.load() != PinnedEpoch)
+		{
+			RewardSnapshot::Readers[ReaderSlot].fetch_sub(1);
+			continue;
+		}
+
+		Snapshot = RewardSnapshot::Current.load();
+		if (Snapshot)
+		{
+			break;
+		}
+
+		// 최초 접근 : 고정 해제 후 스냅샷 구성, 재고정
+		RewardSnapshot::Readers[ReaderSlot].fetch_sub(1);
+		FRewardDataSnapshot::Publish(nullptr);
+	}
+}
+
+FRewardSnapshotPin::~FRewardSnapshotPin()
+{
+	RewardSnapshot::Readers[ReaderSlot].fetch_sub(1, std::memory_order_release);
+}
+
+void FRewardDataSnapshot::Rebuild()
+{
+	Publish(Build());
+}
+
+/**
+ * 스냅샷 교체
+ * InSnapshot이 nullptr이면 최초 구성 (이미 있으면 무시)
+ */
+void FRewardDataSnapshot::Publish(TUniquePtr<FRewardDataSnapshot> InSnapshot)
+{
+	{
+		FScopeLock Lock(&RewardSnapshot::PublishLock);
+
+		if (!InSnapshot)
+		{
+			if (RewardSnapshot::Current.load())
+			{
+				return;
+			}
+			InSnapshot = Build();
+		}
+
+		InSnapshot->Version = RewardSnapshot::NextVersion++;
+		FRewardDataSnapshot* Previous = RewardSnapshot::Current.exchange(InSnapshot.Release());
+
+		// 유예 기간 : 이전 Epoch의 읽기가 모두 끝날 때까지 대기
+		const uint64 PreviousEpoch = RewardSnapshot::Epoch.fetch_add(1);
+		std::atomic<int32>& PreviousReaders = RewardSnapshot::Readers[PreviousEpoch & 1];
+		while (PreviousReaders.load(std::memory_order_acquire) != 0)
+		{
+			FPlatformProcess::Yield();
+		}
+
+		// 로그 : [RewardSnapshot] Published version %llu
+		delete Previous;
+	}
+
+	// 락 해제 후 알림 (구독자가 스냅샷을 고정해도 교체와 경합 없음)
+	if (IsInGameThread())
+	{
+		RewardSnapshot::Published.Broadcast();
+	}
+	else
+	{
+		AsyncTask(ENamedThreads::GameThread, []()
+		{
+			RewardSnapshot::Published.Broadcast();
+		});
+	}
+}
+
+FSimpleMulticastDelegate& FRewardDataSnapshot::OnPublished()
+{
+	return RewardSnapshot::Published;
+}
+
+TUniquePtr<FRewardDataSnapshot> FRewardDataSnapshot::Build()
+{
+	const FString BundlePath = FRewardDataBundle::GetCommandLinePath();
+	if (!BundlePath.IsEmpty())
+	{
+		if (const TSharedPtr<const FRewardDataBundle> LoadedBundle = FRewardDataBundle::Load(BundlePath))
+		{
+			return BuildFromBundle(LoadedBundle.ToSharedRef());
+		}
+
+		// 로그 : [RewardSnapshot] Bundle load failed, fallback to data tables
+	}
+
+	return BuildFromTables();
+}
+
+/**
+ * 스냅샷 컴파일 (데이터 테이블)
+ *
+ * 로직:
+ * 1. 아이템 : 스택/슬롯 메타데이터
+ * 2. 보상 데이터 : 전체 행 ID 먼저 할당 (하위 보상팩 참조 해석용)
+ *    → 고정 보상 사본 + 랜덤/가챠 추첨기 (보상마다 행 ID 해석)
+ * 3. 캠페인 : 피티 설정 사본 + 배너 일정 인덱스
+ */
+TUniquePtr<FRewardDataSnapshot> FRewardDataSnapshot::BuildFromTables()
+{
+	TUniquePtr<FRewardDataSnapshot> Snapshot = MakeUnique<FRewardDataSnapshot>();
+	const UDataTable* ScheduleTable = GetDefault<UGachaBannerScheduleSettings>()->ScheduleTable.LoadSynchronous();
+
+	UItemDataTable::Visit([&Snapshot](const FItemBaseData* Data)
+	{
+		FCompiledItemData& Compiled = Snapshot->Items[Snapshot->AddItemRow(Data->DataRowName, Data->ItemID)];
+		Compiled.MaxStackAmount = Data->MaxStackAmount;
+		Compiled.bNonStackable = Data->IsNonStackable();
+		Compiled.bRequiresInventorySlot = Data->RequiresInventorySlot();
+	});
+
+	TArray<const URewardData*> RewardRows;
+	URewardDataTable::Visit([&Snapshot, &RewardRows](const URewardData* Data)
+	{
+		if (Snapshot->AddRewardRow(Data->DataRowName) == RewardRows.Num())
+		{
+			RewardRows.Emplace(Data);
+		}
+	});
+
+	for (int32 RowId = 0; RowId < RewardRows.Num(); ++RowId)
+	{
+		const URewardData* Data = RewardRows[RowId];
+		FCompiledRewardData& Compiled = Snapshot->Rewards[RowId];
+		Compiled.RewardGroupName = Data->RewardGroupName;
+		Compiled.TotalWeight = Data->TotalWeight;
+		Compiled.TotalGachaWeight = Data->TotalGachaWeight;
+
+		Compiled.Statics.reserve(Data->Statics.Num());
+		for (const FRewardHandler& Static : Data->Statics)
+		{
+			Compiled.Statics.emplace_back(Snapshot->Compile(Static));
+		}
+
+		for (const TObjectPtr<URewardRandomData>& Random : Data->Randoms)
+		{
+			if (Random)
+			{
+				Compiled.Randoms.AddEntry(Snapshot->Compile(Random->Reward), Random->Weight);
+			}
+		}
+		Compiled.Randoms.Compile();
+
+		for (const TObjectPtr<URewardGachaRandomData>& GachaRandom : Data->GachaRandoms)
+		{
+			if (GachaRandom)
+			{
+				Compiled.Gacha.AddEntry(Snapshot->Compile(GachaRandom->Reward), GachaRandom->Weight, GachaRandom->PickupGroup);
+			}
+		}
+		Compiled.Gacha.Compile();
+	}
+
+	UGachaCampaignDataTable::Visit([&Snapshot, ScheduleTable](const FGachaCampaignData* Data)
+	{
+		FCompiledGachaCampaign Compiled;
+		Compiled.RowName = Data->DataRowName;
+		Compiled.RewardGroupRowName = Data->RewardGroupRowName;
+		Compiled.NormalPickupGroup = Data->NormalPickupGroup;
+		Compiled.SpecialPickupGroup = Data->SpecialPickupGroup;
+		Compiled.SpecialTryCount = Data->SpecialTryCount;
+
+		if (FGachaBannerSchedule::ApplyScheduleRow(ScheduleTable, Compiled))
+		{
+			Snapshot->Campaigns.Emplace(Compiled);
+		}
+	});
+
+	// Campaigns는 이후 재할당되지 않음 (일정 인덱스가 주소 참조)
+	Snapshot->Schedule.Build(Snapshot->Campaigns);
+
+	// 로그 : [RewardSnapshot] Rewards %d, Items %d, Campaigns %d
+	return Snapshot;
+}
+
+/**
+ * 스냅샷 컴파일 (쿡된 번들)
+ * 번들 행을 그대로 읽어 구성 (UObject/데이터 테이블 로드 없음)
+ * 행 ID = 번들 내 행 순서, 구성 후 번들은 보관하지 않음 (이름은 FName으로 복사)
+ */
+TUniquePtr<FRewardDataSnapshot> FRewardDataSnapshot::BuildFromBundle(const TSharedRef<const FRewardDataBundle>& InBundle)
+{
+	TUniquePtr<FRewardDataSnapshot> Snapshot = MakeUnique<FRewardDataSnapshot>();
+
+	const FRewardDataBundle& Bundle = *InBundle;
+	const TConstArrayView<FRewardBundleHandler> Handlers = Bundle.GetRows<FRewardBundleHandler>(ERewardBundleSection::RewardHandlers);
+	const TConstArrayView<FRewardBundleEntry> Entries = Bundle.GetRows<FRewardBundleEntry>(ERewardBundleSection::RewardEntries);
+
+	auto ToHandler = [&Bundle](const FRewardBundleHandler& InHandler)
+	{
+		return FRewardHandler(static_cast<EReward>(InHandler.RewardType), Bundle.GetName(InHandler.Name), InHandler.Amount, static_cast<ERewardSource>(InHandler.AcquireSource));
+	};
+
+	const TConstArrayView<FRewardBundleItemRow> ItemRows = Bundle.GetRows<FRewardBundleItemRow>(ERewardBundleSection::ItemRows);
+	Snapshot->Items.Reserve(ItemRows.Num());
+	for (const FRewardBundleItemRow& Row : ItemRows)
+	{
+		FCompiledItemData& Compiled = Snapshot->Items[Snapshot->AddItemRow(Bundle.GetName(Row.Name), Row.ItemID)];
+		Compiled.MaxStackAmount = Row.MaxStackAmount;
+		Compiled.bNonStackable = Row.bNonStackable != 0;
+		Compiled.bRequiresInventorySlot = Row.bRequiresInventorySlot != 0;
+	}
+
+	const TConstArrayView<FRewardBundleRewardRow> RewardRows = Bundle.GetRows<FRewardBundleRewardRow>(ERewardBundleSection::RewardRows);
+	Snapshot->Rewards.Reserve(RewardRows.Num());
+	for (const FRewardBundleRewardRow& Row : RewardRows)
+	{
+		Snapshot->AddRewardRow(Bundle.GetName(Row.Name));
+	}
+
+	for (int32 RowId = 0; RowId < RewardRows.Num(); ++RowId)
+	{
+		const FRewardBundleRewardRow& Row = RewardRows[RowId];
+		FCompiledRewardData& Compiled = Snapshot->Rewards[RowId];
+		Compiled.RewardGroupName = Bundle.GetName(Row.RewardGroupName);
+		Compiled.TotalWeight = Row.TotalWeight;
+		Compiled.TotalGachaWeight = Row.TotalGachaWeight;
+
+		Compiled.Statics.reserve(Row.StaticNum);
+		for (uint32 Index = Row.FirstStatic; Index < Row.FirstStatic + Row.StaticNum; ++Index)
+		{
+			Compiled.Statics.emplace_back(Snapshot->Compile(ToHandler(Handlers[Index])));
+		}
+
+		for (uint32 Index = Row.FirstRandom; Index < Row.FirstRandom + Row.RandomNum; ++Index)
+		{
+			Compiled.Randoms.AddEntry(Snapshot->Compile(ToHandler(Entries[Index].Reward)), Entries[Index].Weight);
+		}
+		Compiled.Randoms.Compile();
+
+		for (uint32 Index = Row.FirstGacha; Index < Row.FirstGacha + Row.GachaNum; ++Index)
+		{
+			Compiled.Gacha.AddEntry(Snapshot->Compile(ToHandler(Entries[Index].Reward)), Entries[Index].Weight, Entries[Index].PickupGroup);
+		}
+		Compiled.Gacha.Compile();
+	}
+
+	const TConstArrayView<FRewardBundleCampaignRow> CampaignRows = Bundle.GetRows<FRewardBundleCampaignRow>(ERewardBundleSection::CampaignRows);
+	Snapshot->Campaigns.Reserve(CampaignRows.Num());
+	for (const FRewardBundleCampaignRow& Row : CampaignRows)
+	{
+		FCompiledGachaCampaign& Compiled = Snapshot->Campaigns.AddDefaulted_GetRef();
+		Compiled.RowName = Bundle.GetName(Row.Name);
+		Compiled.RewardGroupRowName = Bundle.GetName(Row.RewardGroupRowName);
+		Compiled.NormalPickupGroup = Row.NormalPickupGroup;
+		Compiled.SpecialPickupGroup = Row.SpecialPickupGroup;
+		Compiled.SpecialTryCount = Row.SpecialTryCount;
+		Compiled.StartTicks = Row.StartTicks;
+		Compiled.EndTicks = Row.EndTicks;
+	}
+
+	Snapshot->Schedule.Build(Snapshot->Campaigns);
+
+	// 로그 : [RewardSnapshot] From bundle : Rewards %d, Items %d, Campaigns %d
+	return Snapshot;
+}
+
+FRewardRowId FRewardDataSnapshot::FindRewardId(const FName& InRowName) const
+{
+	const FRewardRowId* RowId = RewardIds.Find(InRowName);
+	return RowId ? *RowId : InvalidRewardRowId;
+}
+
+FRewardRowId FRewardDataSnapshot::FindItemId(const FName& InRowName) const
+{
+	const FRewardRowId* RowId = ItemIds.Find(InRowName);
+	return RowId ? *RowId : InvalidRewardRowId;
+}
+
+FRewardRowId FRewardDataSnapshot::FindItemIdByItemID(const int32 InItemID) const
+{
+	const FRewardRowId* RowId = ItemIdsByItemID.Find(InItemID);
+	return RowId ? *RowId : InvalidRewardRowId;
+}
+
+FRewardRowId FRewardDataSnapshot::ResolveRowId(const EReward InRewardType, const FName& InRowName) const
+{
+	switch (InRewardType)
+	{
+	case EReward::RewardData:	return FindRewardId(InRowName);
+	case EReward::Item:			return FindItemId(InRowName);
+	default:					return InvalidRewardRowId;
+	}
+}
+
+/**
+ * 행 등록 (중복 이름은 기존 ID 반환)
+ */
+FRewardRowId FRewardDataSnapshot::AddRewardRow(const FName& InRowName)
+{
+	if (const FRewardRowId* RowId = RewardIds.Find(InRowName))
+	{
+		return *RowId;
+	}
+
+	const FRewardRowId RowId = Rewards.AddDefaulted();
+	RewardNames.Emplace(InRowName);
+	RewardIds.Add(InRowName, RowId);
+	return RowId;
+}
+
+FRewardRowId FRewardDataSnapshot::AddItemRow(const FName& InRowName, const int32 InItemID)
+{
+	if (const FRewardRowId* RowId = ItemIds.Find(InRowName))
+	{
+		return *RowId;
+	}
+
+	const FRewardRowId RowId = Items.AddDefaulted();
+	ItemNames.Emplace(InRowName);
+	ItemIds.Add(InRowName, RowId);
+	ItemIdsByItemID.Add(InItemID, RowId);
+	return RowId;
+}
+
+FPackedReward FRewardDataSnapshot::Compile(const FRewardHandler& InHandler)
+{
+	FPackedReward Packed;
+	if (Pack(InHandler, Packed) || InHandler.TypeRowName.IsNone())
+	{
+		return Packed;
+	}
+
+	// 행 없는 이름 등록
+	uint32& NameId = HandlerNameIds.FindOrAdd(InHandler.TypeRowName, HandlerNames.Num());
+	if (NameId == static_cast<uint32>(HandlerNames.Num()))
+	{
+		HandlerNames.Emplace(InHandler.TypeRowName);
+	}
+
+	Packed.Id = NameId;
+	Packed.Flags |= FPackedReward::NameOnly;
+	return Packed;
+}
+
+bool FRewardDataSnapshot::Pack(const FRewardHandler& InHandler, FPackedReward& OutPacked) const
+{
+	OutPacked = FPackedReward();
+	OutPacked.Amount = InHandler.Amount;
+	OutPacked.RewardType = static_cast<uint8>(InHandler.RewardType);
+	OutPacked.AcquireSource = static_cast<uint8>(InHandler.AcquireSource);
+	OutPacked.Flags = static_cast<uint8>(FPackedReward::NameOnly | GetRewardKindFlags(InHandler.RewardType));
+
+	if (InHandler.TypeRowName.IsNone())
+	{
+		return true;
+	}
+
+	const FRewardRowId RowId = ResolveRowId(InHandler.RewardType, InHandler.TypeRowName);
+	if (RowId != InvalidRewardRowId)
+	{
+		OutPacked.Id = RowId;
+		OutPacked.Flags &= ~FPackedReward::NameOnly;
+		return true;
+	}
+
+	if (const uint32* NameId = HandlerNameIds.Find(InHandler.TypeRowName))
+	{
+		OutPacked.Id = *NameId;
+		return true;
+	}
+
+	return false;
+}
+
+FRewardHandler FRewardDataSnapshot::Unpack(const FPackedReward& InPacked) const
+{
+	const EReward RewardType = static_cast<EReward>(InPacked.RewardType);
+
+	FName RowName = NAME_None;
+	if (InPacked.Id != InvalidRewardRowId)
+	{
+		if (InPacked.Flags & FPackedReward::NameOnly)
+		{
+			RowName = HandlerNames[InPacked.Id];
+		}
+		else
+		{
+			RowName = RewardType == EReward::Item ? ItemNames[InPacked.Id] : RewardNames[InPacked.Id];
+		}
+	}
+
+	return FRewardHandler(RewardType, RowName, InPacked.Amount, static_cast<ERewardSource>(InPacked.AcquireSource));
+}
+
+void FRewardDataSnapshot::Unpack(TConstArrayView<FPackedReward> InPacked, TArray<FRewardHandler>& OutHandlers) const
+{
+	OutHandlers.Reserve(OutHandlers.Num() + InPacked.Num());
+	for (const FPackedReward& Packed : InPacked)
+	{
+		OutHandlers.Emplace(Unpack(Packed));
+	}
+}
@@ -0,0 +1,197 @@
+/**
+ * Reward Data Snapshot
+ *
+ * 주요 기능:
+ * - 보상/가챠/캠페인/아이템 테이블을 불변 스냅샷으로 컴파일
+ * - 읽기 측은 락 없이 스냅샷 고정(Pin)
+ * - 새 스냅샷 원자적 교체 (라이브 중 확률 수정, 재시작 불필요)
+ * - 행 이름 → 연속 정수 ID (핫 경로는 배열 인덱스로 조회, 이름은 입출력/로그에서만)
+ *
+ * 기술 하이라이트:
+ * - Epoch 기반 RCU : 읽기 카운터 2개(짝/홀 Epoch) + 원자적 포인터
+ * - 교체 측만 유예 기간(grace period) 대기, 읽기 측은 대기 없음
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GachaBannerSchedule.h"
+#include "PackedReward.h"
+#include "RewardCore/Interfaces.h"
+#include "Subsystems/RewardManager.h"
+
+class FRewardDataBundle;
+
+/**
+ * 컴파일된 보상 데이터 (URewardData 사본)
+ * 고정/랜덤/가챠 보상은 코어 정의 그대로, 캠페인 조회용 그룹 이름만 추가
+ */
+struct FCompiledRewardData : public RewardCore::FRewardDefinition
+{
+	FName RewardGroupName;
+};
+
+/**
+ * 컴파일된 아이템 메타데이터 (인벤토리 시뮬레이션용)
+ */
+using FCompiledItemData = RewardCore::FItemDefinition;
+
+/**
+ * 불변 보상 데이터 스냅샷
+ *
+ * 사용법:
+ *   FRewardSnapshotPin Snapshot;
+ *   const FRewardRowId RowId = Snapshot->FindRewardId(RowName);		// 입력 경계에서 1회
+ *   const FCompiledRewardData& RewardData = Snapshot->GetReward(RowId);	// 이후는 ID로
+ */
+class FRewardDataSnapshot : public RewardCore::IRewardData
+{
+public:
+	/**
+	 * 현재 데이터 테이블로 새 스냅샷 컴파일 후 교체
+	 * 데이터 테이블 재로드 후 호출 (Reward.ReloadSnapshot 콘솔 명령)
+	 *
+	 * 주의 : 스냅샷을 고정한 스레드에서 호출 금지 (유예 기간 대기)
+	 */
+	static void Rebuild();
+
+	/**
+	 * 스냅샷 교체
+	 * 이전 스냅샷은 모든 읽기가 끝난 뒤 해제
+	 */
+	static void Publish(TUniquePtr<FRewardDataSnapshot> InSnapshot);
+
+	/**
+	 * 스냅샷 교체 알림 (게임 스레드에서 브로드캐스트)
+	 * 스냅샷에서 파생된 캐시 재구성용
+	 */
+	static FSimpleMulticastDelegate& OnPublished();
+
+	// 이름 → ID (없으면 InvalidRewardRowId)
+	FRewardRowId FindRewardId(const FName& InRowName) const;
+	FRewardRowId FindItemId(const FName& InRowName) const;
+
+	/**
+	 * 아이템 ID(인벤토리/DB 키) → 아이템 행 ID (없으면 InvalidRewardRowId)
+	 */
+	FRewardRowId FindItemIdByItemID(const int32 InItemID) const;
+
+	/**
+	 * 보상 종류에 맞는 테이블의 행 ID (RewardData/Item 외에는 InvalidRewardRowId)
+	 */
+	FRewardRowId ResolveRowId(const EReward InRewardType, const FName& InRowName) const;
+
+	// ID → 데이터 (유효한 ID만)
+	const FCompiledRewardData& GetReward(const FRewardRowId InRowId) const { return Rewards[InRowId]; }
+	const FCompiledItemData& GetItem(const FRewardRowId InRowId) const { return Items[InRowId]; }
+	int32 GetItemNum() const { return Items.Num(); }
+
+	// ID → 이름 (로그/직렬화용)
+	const FName& GetRewardName(const FRewardRowId InRowId) const { return RewardNames[InRowId]; }
+	const FName& GetItemName(const FRewardRowId InRowId) const { return ItemNames[InRowId]; }
+
+	const FCompiledRewardData* FindReward(const FName& InRowName) const
+	{
+		const FRewardRowId RowId = FindRewardId(InRowName);
+		return RowId != InvalidRewardRowId ? &Rewards[RowId] : nullptr;
+	}
+
+	const FCompiledItemData* FindItem(const FName& InRowName) const
+	{
+		const FRewardRowId RowId = FindItemId(InRowName);
+		return RowId != InvalidRewardRowId ? &Items[RowId] : nullptr;
+	}
+
+	// RewardCore::IRewardData (코어 로직은 ID로만 조회)
+	virtual const RewardCore::FRewardDefinition* GetRewardDefinition(const FRewardRowId InRowId) const override
+	{
+		return Rewards.IsValidIndex(static_cast<int32>(InRowId)) ? &Rewards[InRowId] : nullptr;
+	}
+
+	virtual const RewardCore::FItemDefinition* GetItemDefinition(const FRewardRowId InRowId) const override
+	{
+		return Items.IsValidIndex(static_cast<int32>(InRowId)) ? &Items[InRowId] : nullptr;
+	}
+
+	virtual int32 GetRewardDefinitionNum() const override { return Rewards.Num(); }
+	virtual int32 GetItemDefinitionNum() const override { return Items.Num(); }
+
+	/**
+	 * FRewardHandler → FPackedReward
+	 * @return 스냅샷에 없는 이름이면 false
+	 */
+	bool Pack(const FRewardHandler& InHandler, FPackedReward& OutPacked) const;
+
+	/**
+	 * FPackedReward → FRewardHandler (Id 없으면 NAME_None)
+	 */
+	FRewardHandler Unpack(const FPackedReward& InPacked) const;
+
+	/**
+	 * 일괄 변환 (OutHandlers 뒤에 추가)
+	 */
+	void Unpack(TConstArrayView<FPackedReward> InPacked, TArray<FRewardHandler>& OutHandlers) const;
+	const FGachaBannerSchedule& GetSchedule() const { return Schedule; }
+	uint64 GetVersion() const { return Version; }
+
+private:
+	/**
+	 * -RewardBundle=<경로>가 있으면 번들에서, 없거나 실패하면 데이터 테이블에서 구성
+	 */
+	static TUniquePtr<FRewardDataSnapshot> Build();
+	static TUniquePtr<FRewardDataSnapshot> BuildFromTables();
+	static TUniquePtr<FRewardDataSnapshot> BuildFromBundle(const TSharedRef<const FRewardDataBundle>& InBundle);
+
+	FRewardRowId AddRewardRow(const FName& InRowName);
+	FRewardRowId AddItemRow(const FName& InRowName, const int32 InItemID);
+
+	/**
+	 * 컴파일 시 변환 (행 없는 이름은 이름 ID로 등록)
+	 */
+	FPackedReward Compile(const FRewardHandler& InHandler);
+
+	uint64 Version = 0;
+
+	// ID로 인덱싱되는 평탄 배열 + 입력 경계용 이름 맵
+	TArray<FCompiledRewardData> Rewards;
+	TArray<FName> RewardNames;
+	TMap<FName, FRewardRowId> RewardIds;
+
+	TArray<FCompiledItemData> Items;
+	TArray<FName> ItemNames;
+	TMap<FName, FRewardRowId> ItemIds;
+	TMap<int32, FRewardRowId> ItemIdsByItemID;
+
+	// 행 ID가 없는 보상 이름 (FPackedReward::NameOnly)
+	TArray<FName> HandlerNames;
+	TMap<FName, uint32> HandlerNameIds;
+
+	TArray<FCompiledGachaCampaign> Campaigns;
+	FGachaBannerSchedule Schedule;
+
+	friend class FRewardSnapshotPin;
+};
+
+/**
+ * 스냅샷 고정 (RAII)
+ *
+ * - 생성 시 현재 스냅샷 고정, 소멸 시 해제
+ * - 락 없음 (원자적 카운터 증감만)
+ * - 중첩 고정 가능
+ */
+class FRewardSnapshotPin
+{
+public:
+	FRewardSnapshotPin();
+	~FRewardSnapshotPin();
+
+	FRewardSnapshotPin(const FRewardSnapshotPin&) = delete;
+	FRewardSnapshotPin& operator=(const FRewardSnapshotPin&) = delete;
+
+	const FRewardDataSnapshot* operator->() const { return Snapshot; }
+	const FRewardDataSnapshot& operator*() const { return *Snapshot; }
+
+private:
+	const FRewardDataSnapshot* Snapshot = nullptr;
+	uint32 ReaderSlot = 0;
+};
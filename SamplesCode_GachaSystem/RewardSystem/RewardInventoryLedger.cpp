@@ -0,0 +1,86 @@
+/**
+ * Reward Inventory Ledger Implementation
+ */
+
+#include "RewardInventoryLedger.h"
+
+namespace RewardInventoryLedger
+{
+	// 예약 ID는 스레드 전용 인라인 배열에 보관 (가장 바깥 스코프 소멸 시 1회 정산)
+	struct FTransaction
+	{
+		int32 Depth = 0;
+		bool bCommitted = false;
+		TArray<RewardCore::FReservationId, TInlineAllocator<8>> Reservations;
+	};
+
+	FTransaction& GetTransaction()
+	{
+		thread_local FTransaction Transaction;
+		return Transaction;
+	}
+}
+
+RewardCore::FInventoryLedger& FRewardInventoryLedger::Get()
+{
+	static RewardCore::FInventoryLedger Ledger;
+	return Ledger;
+}
+
+FRewardReservationScope::FRewardReservationScope()
+{
+	++RewardInventoryLedger::GetTransaction().Depth;
+}
+
+FRewardReservationScope::~FRewardReservationScope()
+{
+	RewardInventoryLedger::FTransaction& Transaction = RewardInventoryLedger::GetTransaction();
+	if (--Transaction.Depth > 0)
+	{
+		return;
+	}
+
+	RewardCore::FInventoryLedger& Ledger = FRewardInventoryLedger::Get();
+	for (const RewardCore::FReservationId ReservationId : Transaction.Reservations)
+	{
+		if (Transaction.bCommitted)
+		{
+			Ledger.Commit(ReservationId);
+		}
+		else
+		{
+			Ledger.Release(ReservationId);
+		}
+	}
+
+	// 로그 : [Ledger] Settle %d reservations (committed=%d)
+	Transaction.Reservations.Reset();
+	Transaction.bCommitted = false;
+}
+
+void FRewardReservationScope::MarkCommitted()
+{
+	RewardInventoryLedger::GetTransaction().bCommitted = true;
+}
+
+bool FRewardReservationScope::IsOpen()
+{
+	return RewardInventoryLedger::GetTransaction().Depth > 0;
+}
+
+void FRewardReservationScope::Add(const RewardCore::FReservationId InReservationId)
+{
+	if (InReservationId == RewardCore::InvalidReservationId)
+	{
+		return;
+	}
+
+	if (!IsOpen())
+	{
+		// 로그 : [Ledger] Reservation outside a transaction scope, releasing
+		FRewardInventoryLedger::Get().Release(InReservationId);
+		return;
+	}
+
+	RewardInventoryLedger::GetTransaction().Reservations.Add(InReservationId);
+}
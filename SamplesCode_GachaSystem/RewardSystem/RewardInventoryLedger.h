@@ -0,0 +1,53 @@
+/**
+ * Reward Inventory Ledger
+ *
+ * 주요 기능:
+ * - 서버 전역 인벤토리 예약 원장 (RewardCore::FInventoryLedger)
+ * - SimulateRewards가 통과시킨 슬롯/스택 여유분을 지급 반영까지 예약
+ * - 같은 계정의 지급 트랜잭션을 동시에 실행해도 용량 초과 없음
+ *
+ * 예약 수명:
+ * - 예약 스코프 안에서만 예약, 트랜잭션 종료 시 정산 (커밋 표시 → 커밋, 그 외 → 해제)
+ * - 스코프 밖 SimulateRewards는 예약 없이 판정만 (기존 동작, 반영 후 이중 계산 없음)
+ *
+ * 사용 (지급 트랜잭션 경계, 예 : OnPostGive_Gacha의 GiveRewards):
+ *   FRewardReservationScope ReservationScope;
+ *   ... SimulateRewards / 지급 / 저장소 반영 ...
+ *   ReservationScope.MarkCommitted();			// 반영 성공 시
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RewardCore/InventoryLedger.h"
+
+class FRewardInventoryLedger
+{
+public:
+	static RewardCore::FInventoryLedger& Get();
+};
+
+/**
+ * 스레드별 중첩 가능 (안쪽 스코프는 바깥 스코프에 합류, 가장 바깥 스코프가 정산)
+ */
+class FRewardReservationScope
+{
+public:
+	FRewardReservationScope();
+	~FRewardReservationScope();
+
+	FRewardReservationScope(const FRewardReservationScope&) = delete;
+	FRewardReservationScope& operator=(const FRewardReservationScope&) = delete;
+
+	/**
+	 * 트랜잭션 반영 성공 표시
+	 */
+	void MarkCommitted();
+
+	static bool IsOpen();
+
+	/**
+	 * 현재 트랜잭션 예약 추가 (스코프 안에서만 호출)
+	 */
+	static void Add(const RewardCore::FReservationId InReservationId);
+};
@@ -0,0 +1,274 @@
+/**
+ * Reward Stage Stats Implementation
+ */
+
+#include "RewardStageStats.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+namespace RewardStageStats
+{
+	bool bEnabled = true;
+
+	static FAutoConsoleVariableRef EnabledVariable(
+		TEXT("Reward.Stats.Enabled"),
+		bEnabled,
+		TEXT("Record per-stage latency histograms of the reward grant pipeline."));
+
+	/**
+	 * 스레드 전용 구간 히스토그램
+	 */
+	struct FThreadStats
+	{
+		FRewardStageHistogram Stages[static_cast<int32>(ERewardStage::Num)];
+
+		// 마지막으로 비운 세대 (Generation과 다르면 다음 기록 전에 비움)
+		std::atomic<uint32> Generation{ 0 };
+	};
+
+	std::atomic<uint32> Generation{ 0 };
+
+	// 등록된 스레드 (스레드 종료 후에도 유지, 서버 워커 수만큼만 생성)
+	FCriticalSection Lock;
+	TArray<TUniquePtr<FThreadStats>> Threads;
+
+	FThreadStats& GetThreadStats()
+	{
+		thread_local FThreadStats* Stats = nullptr;
+		if (!Stats)
+		{
+			FScopeLock ScopeLock(&Lock);
+			Stats = Threads.Emplace_GetRef(MakeUnique<FThreadStats>()).Get();
+			Stats->Generation.store(Generation.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		}
+		return *Stats;
+	}
+
+	template <typename T>
+	void Increment(std::atomic<T>& InOutValue, const T InDelta)
+	{
+		InOutValue.store(InOutValue.load(std::memory_order_relaxed) + InDelta, std::memory_order_relaxed);
+	}
+
+	static FAutoConsoleCommand DumpCommand(
+		TEXT("Reward.Stats.Dump"),
+		TEXT("Log reward pipeline stage latencies and write Saved/Profiling/RewardStageStats.json."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			FRewardStageStats::Dump();
+		}));
+
+	static FAutoConsoleCommand ResetCommand(
+		TEXT("Reward.Stats.Reset"),
+		TEXT("Reset reward pipeline stage latency histograms."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			FRewardStageStats::Reset();
+		}));
+}
+
+#pragma region Histogram
+
+/**
+ * 예시 (SubBucketBits 4):
+ * - 0 ~ 15 : 값 그대로
+ * - 16 ~ 31 : 인덱스 16 ~ 31 (폭 1)
+ * - 1000 (2^9 ~ 2^10) : 상위 4비트(1111) → 6 * 16 + 15 = 111 (폭 32)
+ */
+int32 FRewardStageHistogram::GetBucketIndex(const uint64 InCycles)
+{
+	if (InCycles < SubBucketNum)
+	{
+		return static_cast<int32>(InCycles);
+	}
+
+	const int32 Exponent = static_cast<int32>(FMath::FloorLog2_64(InCycles));
+	if (Exponent >= MaxExponent)
+	{
+		return NumBuckets - 1;
+	}
+
+	const int32 SubBucket = static_cast<int32>((InCycles >> (Exponent - SubBucketBits)) & (SubBucketNum - 1));
+	return (Exponent - SubBucketBits + 1) * SubBucketNum + SubBucket;
+}
+
+uint64 FRewardStageHistogram::GetBucketUpperBound(const int32 InBucket)
+{
+	if (InBucket < SubBucketNum)
+	{
+		return static_cast<uint64>(InBucket) + 1;
+	}
+
+	const int32 Exponent = InBucket / SubBucketNum + SubBucketBits - 1;
+	const uint64 SubBucket = static_cast<uint64>(InBucket % SubBucketNum);
+	return (SubBucketNum + SubBucket + 1) << (Exponent - SubBucketBits);
+}
+
+void FRewardStageHistogram::Add(const uint64 InCycles)
+{
+	using RewardStageStats::Increment;
+
+	Increment(Buckets[GetBucketIndex(InCycles)], 1u);
+	Increment(Count, 1ull);
+	Increment(SumCycles, InCycles);
+
+	if (InCycles > MaxCycles.load(std::memory_order_relaxed))
+	{
+		MaxCycles.store(InCycles, std::memory_order_relaxed);
+	}
+}
+
+void FRewardStageHistogram::Clear()
+{
+	for (std::atomic<uint32>& Bucket : Buckets)
+	{
+		Bucket.store(0, std::memory_order_relaxed);
+	}
+	Count.store(0, std::memory_order_relaxed);
+	SumCycles.store(0, std::memory_order_relaxed);
+	MaxCycles.store(0, std::memory_order_relaxed);
+}
+
+void FRewardStageSummary::Merge(const FRewardStageHistogram& InHistogram)
+{
+	if (Buckets.IsEmpty())
+	{
+		Buckets.SetNumZeroed(FRewardStageHistogram::NumBuckets);
+	}
+
+	for (int32 Bucket = 0; Bucket < FRewardStageHistogram::NumBuckets; ++Bucket)
+	{
+		Buckets[Bucket] += InHistogram.Buckets[Bucket].load(std::memory_order_relaxed);
+	}
+	Count += InHistogram.Count.load(std::memory_order_relaxed);
+	SumCycles += InHistogram.SumCycles.load(std::memory_order_relaxed);
+	MaxCycles = FMath::Max(MaxCycles, InHistogram.MaxCycles.load(std::memory_order_relaxed));
+}
+
+uint64 FRewardStageSummary::GetPercentile(const double InPercentile) const
+{
+	if (Count == 0)
+	{
+		return 0;
+	}
+
+	const uint64 Target = FMath::Max<uint64>(1, static_cast<uint64>(FMath::CeilToDouble(static_cast<double>(Count) * FMath::Clamp(InPercentile, 0.0, 1.0))));
+
+	uint64 Accumulated = 0;
+	for (int32 Bucket = 0; Bucket < Buckets.Num(); ++Bucket)
+	{
+		Accumulated += Buckets[Bucket];
+		if (Accumulated >= Target)
+		{
+			return FMath::Min(FRewardStageHistogram::GetBucketUpperBound(Bucket), MaxCycles);
+		}
+	}
+	return MaxCycles;
+}
+
+#pragma endregion Histogram
+
+#pragma region Stats
+
+bool FRewardStageStats::IsEnabled()
+{
+	return RewardStageStats::bEnabled;
+}
+
+void FRewardStageStats::Record(const ERewardStage InStage, const uint64 InCycles)
+{
+	RewardStageStats::FThreadStats& Stats = RewardStageStats::GetThreadStats();
+
+	const uint32 Generation = RewardStageStats::Generation.load(std::memory_order_relaxed);
+	if (Stats.Generation.load(std::memory_order_relaxed) != Generation)
+	{
+		for (FRewardStageHistogram& Histogram : Stats.Stages)
+		{
+			Histogram.Clear();
+		}
+		Stats.Generation.store(Generation, std::memory_order_relaxed);
+	}
+
+	Stats.Stages[static_cast<int32>(InStage)].Add(InCycles);
+}
+
+void FRewardStageStats::Collect(FRewardStageSummary (&OutStages)[static_cast<int32>(ERewardStage::Num)])
+{
+	using namespace RewardStageStats;
+
+	const uint32 CurrentGeneration = Generation.load(std::memory_order_relaxed);
+
+	FScopeLock ScopeLock(&Lock);
+	for (const TUniquePtr<FThreadStats>& Stats : Threads)
+	{
+		// 초기화 이후 기록이 없는 스레드 (아직 이전 세대 값 보유)
+		if (Stats->Generation.load(std::memory_order_relaxed) != CurrentGeneration)
+		{
+			continue;
+		}
+
+		for (int32 Stage = 0; Stage < static_cast<int32>(ERewardStage::Num); ++Stage)
+		{
+			OutStages[Stage].Merge(Stats->Stages[Stage]);
+		}
+	}
+}
+
+FString FRewardStageStats::Dump()
+{
+	FRewardStageSummary Stages[static_cast<int32>(ERewardStage::Num)];
+	Collect(Stages);
+
+	const double MicrosecondsPerCycle = FPlatformTime::GetSecondsPerCycle64() * 1.0e6;
+	auto ToUs = [MicrosecondsPerCycle](const uint64 InCycles)
+	{
+		return static_cast<double>(InCycles) * MicrosecondsPerCycle;
+	};
+
+	FString Json = TEXT("{\n\t\"schema\": \"reward-stage-stats/1\",\n\t\"stages\": [\n");
+	for (int32 Stage = 0; Stage < static_cast<int32>(ERewardStage::Num); ++Stage)
+	{
+		const FRewardStageSummary& Summary = Stages[Stage];
+		const double MeanUs = Summary.Count > 0 ? ToUs(Summary.SumCycles) / static_cast<double>(Summary.Count) : 0.0;
+
+		Json += FString::Printf(TEXT("\t\t{ \"name\": \"%s\", \"count\": %llu, \"mean_us\": %.2f, \"p50_us\": %.2f, \"p90_us\": %.2f, \"p99_us\": %.2f, \"p999_us\": %.2f, \"max_us\": %.2f }%s\n"),
+			GetStageName(static_cast<ERewardStage>(Stage)), Summary.Count, MeanUs,
+			ToUs(Summary.GetPercentile(0.5)), ToUs(Summary.GetPercentile(0.9)), ToUs(Summary.GetPercentile(0.99)), ToUs(Summary.GetPercentile(0.999)), ToUs(Summary.MaxCycles),
+			Stage + 1 < static_cast<int32>(ERewardStage::Num) ? TEXT(",") : TEXT(""));
+
+		// 로그 : [RewardStats] %-16s count=%llu mean=%.2fus p50=%.2fus p99=%.2fus max=%.2fus
+	}
+	Json += TEXT("\t]\n}\n");
+
+	const FString OutPath = FPaths::ProjectSavedDir() / TEXT("Profiling/RewardStageStats.json");
+	FFileHelper::SaveStringToFile(Json, *OutPath);
+	// 로그 : [RewardStats] Wrote %s
+
+	return Json;
+}
+
+void FRewardStageStats::Reset()
+{
+	RewardStageStats::Generation.fetch_add(1, std::memory_order_relaxed);
+}
+
+const TCHAR* FRewardStageStats::GetStageName(const ERewardStage InStage)
+{
+	switch (InStage)
+	{
+	case ERewardStage::CampaignLookup:		return TEXT("CampaignLookup");
+	case ERewardStage::PityLoad:			return TEXT("PityLoad");
+	case ERewardStage::PityStore:			return TEXT("PityStore");
+	case ERewardStage::Roll:				return TEXT("Roll");
+	case ERewardStage::BuildRewardData:		return TEXT("BuildRewardData");
+	case ERewardStage::SimulateRewards:		return TEXT("SimulateRewards");
+	case ERewardStage::AddInventoryItem:	return TEXT("AddInventoryItem");
+	case ERewardStage::BuildOptions:		return TEXT("BuildOptions");
+	case ERewardStage::TaskCommit:			return TEXT("TaskCommit");
+	default:								return TEXT("Unknown");
+	}
+}
+
+#pragma endregion Stats
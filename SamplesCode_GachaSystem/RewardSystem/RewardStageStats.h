@@ -0,0 +1,139 @@
+/**
+ * Reward Stage Stats
+ *
+ * 보상 지급 파이프라인 구간별 지연 히스토그램 (상시 계측용)
+ * - 스레드별 히스토그램에 잠금 없이 기록, 덤프 시점에만 병합
+ * - HDR 방식 버킷 (2의 거듭제곱 구간마다 16개 하위 버킷, 상대 오차 ~6%)
+ * - 구간당 비용 : 사이클 카운터 2회 + 버킷 증가 (수십 ns, 구간 자체는 μs~ms 단위)
+ * - 콘솔 : Reward.Stats.Dump / Reward.Stats.Reset / Reward.Stats.Enabled
+ * - 구간 추적(RewardTrace) 중이면 같은 구간을 span으로도 기록
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RewardTrace.h"
+#include <atomic>
+
+/**
+ * 계측 구간
+ */
+enum class ERewardStage : uint8
+{
+	CampaignLookup,		// 판매 중인 캠페인 조회
+	PityLoad,			// 피티 카운터 로드
+	PityStore,			// 피티 카운터 저장
+	Roll,				// 천장 판정 + 추첨 (PullGacha)
+	BuildRewardData,	// 보상팩 전개
+	SimulateRewards,	// 병합 + 슬롯 시뮬레이션
+	AddInventoryItem,	// 아이템 추가 (신규 아이템 INSERT 포함)
+	BuildOptions,		// 장비 서브 옵션 생성
+	TaskCommit,			// 쿼리 태스크 커밋 (태스크 실행 측 GiveReward에서 계측)
+	Num
+};
+
+/**
+ * 사이클 단위 HDR 방식 히스토그램 (단일 기록 스레드, 다른 스레드는 읽기만)
+ */
+struct FRewardStageHistogram
+{
+	static constexpr int32 SubBucketBits = 4;
+	static constexpr int32 SubBucketNum = 1 << SubBucketBits;
+
+	// 2^40 사이클(수 분) 이상은 마지막 버킷
+	static constexpr int32 MaxExponent = 40;
+	static constexpr int32 NumBuckets = (MaxExponent - SubBucketBits + 1) * SubBucketNum;
+
+	std::atomic<uint32> Buckets[NumBuckets]{};
+	std::atomic<uint64> Count{ 0 };
+	std::atomic<uint64> SumCycles{ 0 };
+	std::atomic<uint64> MaxCycles{ 0 };
+
+	/**
+	 * 기록 (소유 스레드 전용, 원자적 RMW 없이 relaxed load/store)
+	 */
+	void Add(const uint64 InCycles);
+	void Clear();
+
+	static int32 GetBucketIndex(const uint64 InCycles);
+	static uint64 GetBucketUpperBound(const int32 InBucket);
+};
+
+/**
+ * 병합된 구간 통계 (덤프용 스냅샷)
+ */
+struct FRewardStageSummary
+{
+	uint64 Count = 0;
+	uint64 SumCycles = 0;
+	uint64 MaxCycles = 0;
+	TArray<uint64> Buckets;
+
+	void Merge(const FRewardStageHistogram& InHistogram);
+
+	/**
+	 * 백분위 (해당 버킷 상한으로 근사, 사이클)
+	 * @param InPercentile 0~1
+	 */
+	uint64 GetPercentile(const double InPercentile) const;
+};
+
+class FRewardStageStats
+{
+public:
+	static bool IsEnabled();
+
+	static void Record(const ERewardStage InStage, const uint64 InCycles);
+
+	/**
+	 * 전체 스레드 병합
+	 */
+	static void Collect(FRewardStageSummary (&OutStages)[static_cast<int32>(ERewardStage::Num)]);
+
+	/**
+	 * 로그 출력 + JSON 저장 (Saved/Profiling/RewardStageStats.json)
+	 */
+	static FString Dump();
+
+	/**
+	 * 초기화 요청 (각 스레드가 다음 기록 시 자기 히스토그램을 비움)
+	 */
+	static void Reset();
+
+	static const TCHAR* GetStageName(const ERewardStage InStage);
+};
+
+/**
+ * 구간 계측 (생성 ~ 소멸)
+ */
+class FRewardStageScope
+{
+public:
+	/**
+	 * @param InHandlerCount 추적 span 속성 (INDEX_NONE이면 바깥 구간 값)
+	 */
+	explicit FRewardStageScope(const ERewardStage InStage, const int32 InHandlerCount = INDEX_NONE)
+		: Stage(InStage)
+		, StartCycles(FRewardStageStats::IsEnabled() ? FPlatformTime::Cycles64() : 0)
+		, Trace(FRewardStageStats::GetStageName(InStage), InHandlerCount)
+	{
+	}
+
+	~FRewardStageScope()
+	{
+		if (StartCycles != 0)
+		{
+			FRewardStageStats::Record(Stage, FPlatformTime::Cycles64() - StartCycles);
+		}
+	}
+
+	void SetHandlerCount(const int32 InHandlerCount) { Trace.SetHandlerCount(InHandlerCount); }
+
+	FRewardStageScope(const FRewardStageScope&) = delete;
+	FRewardStageScope& operator=(const FRewardStageScope&) = delete;
+
+private:
+	ERewardStage Stage;
+	uint64 StartCycles;
+	FRewardTraceScope Trace;
+};
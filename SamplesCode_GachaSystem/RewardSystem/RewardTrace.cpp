@@ -0,0 +1,220 @@
+/**
+ * Reward Trace Implementation
+ */
+
+#include "RewardTrace.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTLS.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace RewardTrace
+{
+	static constexpr uint64 Capacity = 1 << 16;
+
+	struct FEvent
+	{
+		const TCHAR* Name = nullptr;
+		uint64 StartCycles = 0;
+		uint64 EndCycles = 0;
+		int64 AccountId = INDEX_NONE;
+		int32 HandlerCount = 0;
+		uint32 ThreadId = 0;
+
+		// 기록 완료 시 (쓰기 위치 + 1), 기록 중 0
+		std::atomic<uint64> Sequence{ 0 };
+	};
+
+	// 최초 Start 시 할당 (이후 해제하지 않음, 기록 중인 스레드 보호)
+	std::atomic<FEvent*> Events{ nullptr };
+	std::atomic<uint64> WriteIndex{ 0 };
+
+	static FAutoConsoleCommand StartCommand(
+		TEXT("Reward.Trace.Start"),
+		TEXT("Start recording reward transaction spans into the trace ring buffer."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			FRewardTrace::Start();
+		}));
+
+	static FAutoConsoleCommand StopCommand(
+		TEXT("Reward.Trace.Stop"),
+		TEXT("Stop recording reward transaction spans (buffer is kept for Reward.Trace.Dump)."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			FRewardTrace::Stop();
+		}));
+
+	static FAutoConsoleCommand DumpCommand(
+		TEXT("Reward.Trace.Dump"),
+		TEXT("Write buffered reward spans as Chrome Trace Event JSON (arg: path, default Saved/Profiling/RewardTrace.json)."),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& InArgs)
+		{
+			FRewardTrace::Dump(InArgs.Num() > 0 ? InArgs[0] : FPaths::ProjectSavedDir() / TEXT("Profiling/RewardTrace.json"));
+		}));
+}
+
+std::atomic<bool> FRewardTrace::bEnabled{ false };
+
+void FRewardTrace::Start()
+{
+	if (!RewardTrace::Events.load(std::memory_order_acquire))
+	{
+		RewardTrace::FEvent* NewEvents = new RewardTrace::FEvent[RewardTrace::Capacity];
+		RewardTrace::FEvent* Expected = nullptr;
+		if (!RewardTrace::Events.compare_exchange_strong(Expected, NewEvents, std::memory_order_acq_rel))
+		{
+			delete[] NewEvents;
+		}
+	}
+
+	bEnabled.store(true, std::memory_order_relaxed);
+	// 로그 : [RewardTrace] Started (%llu spans)
+}
+
+void FRewardTrace::Stop()
+{
+	bEnabled.store(false, std::memory_order_relaxed);
+	// 로그 : [RewardTrace] Stopped
+}
+
+FRewardTrace::FContext& FRewardTrace::GetContext()
+{
+	thread_local FContext Context;
+	return Context;
+}
+
+void FRewardTrace::AddSpan(const TCHAR* InName, const uint64 InStartCycles, const uint64 InEndCycles)
+{
+	RewardTrace::FEvent* Events = RewardTrace::Events.load(std::memory_order_acquire);
+	if (!Events)
+	{
+		return;
+	}
+
+	const uint64 Index = RewardTrace::WriteIndex.fetch_add(1, std::memory_order_relaxed);
+	RewardTrace::FEvent& Event = Events[Index % RewardTrace::Capacity];
+
+	Event.Sequence.store(0, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	const FContext& Context = GetContext();
+	Event.Name = InName;
+	Event.StartCycles = InStartCycles;
+	Event.EndCycles = InEndCycles;
+	Event.AccountId = Context.AccountId;
+	Event.HandlerCount = Context.HandlerCount;
+	Event.ThreadId = FPlatformTLS::GetCurrentThreadId();
+
+	Event.Sequence.store(Index + 1, std::memory_order_release);
+}
+
+/**
+ * 출력 예:
+ * { "name": "OnPostGive_Gacha", "ph": "X", "ts": 12.3, "dur": 845.0, "pid": 1, "tid": 4242,
+ *   "args": { "account": 1001, "handlers": 10 } }
+ */
+int32 FRewardTrace::Dump(const FString& InPath)
+{
+	RewardTrace::FEvent* Events = RewardTrace::Events.load(std::memory_order_acquire);
+	if (!Events)
+	{
+		return 0;
+	}
+
+	const uint64 End = RewardTrace::WriteIndex.load(std::memory_order_acquire);
+	const uint64 Begin = End > RewardTrace::Capacity ? End - RewardTrace::Capacity : 0;
+
+	struct FSpan
+	{
+		const TCHAR* Name;
+		uint64 StartCycles;
+		uint64 EndCycles;
+		int64 AccountId;
+		int32 HandlerCount;
+		uint32 ThreadId;
+	};
+
+	TArray<FSpan> Spans;
+	Spans.Reserve(static_cast<int32>(End - Begin));
+
+	uint64 BaseCycles = TNumericLimits<uint64>::Max();
+	for (uint64 Index = Begin; Index < End; ++Index)
+	{
+		const RewardTrace::FEvent& Event = Events[Index % RewardTrace::Capacity];
+		if (Event.Sequence.load(std::memory_order_acquire) != Index + 1)
+		{
+			continue;
+		}
+
+		const FSpan Span{ Event.Name, Event.StartCycles, Event.EndCycles, Event.AccountId, Event.HandlerCount, Event.ThreadId };
+
+		// 복사 도중 덮어쓰였으면 제외
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (Event.Sequence.load(std::memory_order_relaxed) != Index + 1)
+		{
+			continue;
+		}
+
+		Spans.Emplace(Span);
+		BaseCycles = FMath::Min(BaseCycles, Span.StartCycles);
+	}
+
+	const double MicrosecondsPerCycle = FPlatformTime::GetSecondsPerCycle64() * 1.0e6;
+
+	FString Json = TEXT("{\n\t\"displayTimeUnit\": \"ms\",\n\t\"traceEvents\": [\n");
+	for (int32 Index = 0; Index < Spans.Num(); ++Index)
+	{
+		const FSpan& Span = Spans[Index];
+		Json += FString::Printf(TEXT("\t\t{ \"name\": \"%s\", \"cat\": \"reward\", \"ph\": \"X\", \"ts\": %.3f, \"dur\": %.3f, \"pid\": 1, \"tid\": %u, \"args\": { \"account\": %lld, \"handlers\": %d } }%s\n"),
+			Span.Name, static_cast<double>(Span.StartCycles - BaseCycles) * MicrosecondsPerCycle, static_cast<double>(Span.EndCycles - Span.StartCycles) * MicrosecondsPerCycle,
+			Span.ThreadId, Span.AccountId, Span.HandlerCount, Index + 1 < Spans.Num() ? TEXT(",") : TEXT(""));
+	}
+	Json += TEXT("\t]\n}\n");
+
+	FFileHelper::SaveStringToFile(Json, *InPath);
+	// 로그 : [RewardTrace] Wrote %d spans to %s
+
+	return Spans.Num();
+}
+
+FRewardTraceScope::FRewardTraceScope(const TCHAR* InName, const int32 InHandlerCount, const int64 InAccountId/* = INDEX_NONE*/)
+	: Name(InName)
+{
+	if (!FRewardTrace::IsEnabled())
+	{
+		return;
+	}
+
+	FRewardTrace::FContext& Context = FRewardTrace::GetContext();
+	PrevContext = Context;
+	if (InHandlerCount != INDEX_NONE)
+	{
+		Context.HandlerCount = InHandlerCount;
+	}
+	if (InAccountId != INDEX_NONE)
+	{
+		Context.AccountId = InAccountId;
+	}
+
+	StartCycles = FPlatformTime::Cycles64();
+}
+
+FRewardTraceScope::~FRewardTraceScope()
+{
+	if (StartCycles == 0)
+	{
+		return;
+	}
+
+	FRewardTrace::AddSpan(Name, StartCycles, FPlatformTime::Cycles64());
+	FRewardTrace::GetContext() = PrevContext;
+}
+
+void FRewardTraceScope::SetHandlerCount(const int32 InHandlerCount)
+{
+	if (StartCycles != 0)
+	{
+		FRewardTrace::GetContext().HandlerCount = InHandlerCount;
+	}
+}
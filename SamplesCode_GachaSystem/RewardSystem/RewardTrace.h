@@ -0,0 +1,75 @@
+/**
+ * Reward Trace
+ *
+ * 보상 트랜잭션 구간(span) 추적 → Chrome Trace Event JSON (chrome://tracing, Perfetto UI)
+ * - 고정 크기 링 버퍼에 최근 구간만 보관, 요청 시 덤프 (쓰기는 위치 원자 증가만, 덤프 중 덮어쓰인 구간 제외)
+ * - 구간마다 계정/보상 핸들러 수 속성 (바깥 구간 값을 안쪽 구간이 상속)
+ * - FRewardStageScope 구간도 추적 중이면 함께 기록 (캠페인 조회, 추첨 등 세부 구간)
+ * - 콘솔 : Reward.Trace.Start / Reward.Trace.Stop / Reward.Trace.Dump [경로]
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+class FRewardTrace
+{
+public:
+	static bool IsEnabled() { return bEnabled.load(std::memory_order_relaxed); }
+
+	static void Start();
+	static void Stop();
+
+	/**
+	 * 링 버퍼 내용을 JSON으로 저장 (기본 Saved/Profiling/RewardTrace.json)
+	 * @return 기록된 구간 수
+	 */
+	static int32 Dump(const FString& InPath);
+
+	/**
+	 * 완료된 구간 기록
+	 * @param InName 정적 문자열 (덤프 시점까지 유효해야 함)
+	 */
+	static void AddSpan(const TCHAR* InName, const uint64 InStartCycles, const uint64 InEndCycles);
+
+	/**
+	 * 현재 스레드 트랜잭션 속성 (FRewardTraceScope가 설정/복원)
+	 */
+	struct FContext
+	{
+		int64 AccountId = INDEX_NONE;
+		int32 HandlerCount = 0;
+	};
+
+	static FContext& GetContext();
+
+private:
+	static std::atomic<bool> bEnabled;
+};
+
+/**
+ * 구간 추적 (생성 ~ 소멸, 추적 중이 아니면 원자 변수 읽기 1회)
+ */
+class FRewardTraceScope
+{
+public:
+	/**
+	 * @param InHandlerCount, InAccountId INDEX_NONE이면 바깥 구간 값 상속
+	 */
+	FRewardTraceScope(const TCHAR* InName, const int32 InHandlerCount, const int64 InAccountId = INDEX_NONE);
+	~FRewardTraceScope();
+
+	/**
+	 * 구간 중 확정된 핸들러 수 (예: 전개 결과 수)
+	 */
+	void SetHandlerCount(const int32 InHandlerCount);
+
+	FRewardTraceScope(const FRewardTraceScope&) = delete;
+	FRewardTraceScope& operator=(const FRewardTraceScope&) = delete;
+
+private:
+	const TCHAR* Name;
+	uint64 StartCycles = 0;
+	FRewardTrace::FContext PrevContext;
+};
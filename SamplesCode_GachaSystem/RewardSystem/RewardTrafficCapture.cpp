@@ -0,0 +1,184 @@
+/**
+ * Reward Traffic Capture Implementation
+ */
+
+#include "RewardTrafficCapture.h"
+#include "RewardCoreAdapters.h"
+#include "RewardDataSnapshot.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include <atomic>
+
+namespace RewardTrafficCapture
+{
+	static constexpr size_t FlushSize = 256 * 1024;
+
+	std::atomic<bool> bCapturing{ false };
+
+	FCriticalSection Lock;
+	TUniquePtr<FArchive> File;
+	RewardCore::FTrafficLogWriter Writer;
+
+	// 마지막으로 기록한 스냅샷 버전 (0 = 아직 없음)
+	uint64 ImageVersion = 0;
+
+	void Flush()
+	{
+		if (File && Writer.GetSize() > 0)
+		{
+			File->Serialize(const_cast<uint8*>(Writer.GetBuffer().data()), static_cast<int64>(Writer.GetSize()));
+		}
+		Writer.Reset();
+	}
+
+	/**
+	 * 잠금 후 (필요 시 DataImage 선행) 레코드 기록
+	 */
+	template <typename FWriteFunc>
+	void Write(const FRewardDataSnapshot& InSnapshot, const FWriteFunc& InWrite)
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (!File)
+		{
+			return;
+		}
+
+		if (ImageVersion != InSnapshot.GetVersion())
+		{
+			ImageVersion = InSnapshot.GetVersion();
+			Writer.WriteDataImage(FRewardTrafficCapture::MakeHeader(0), InSnapshot);
+		}
+
+		InWrite();
+
+		if (Writer.GetSize() >= FlushSize)
+		{
+			Flush();
+		}
+	}
+
+	static FAutoConsoleCommand StartCommand(
+		TEXT("Reward.Capture.Start"),
+		TEXT("Start recording reward pipeline traffic (arg: path, default Saved/Profiling/RewardTraffic.rwtl)."),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& InArgs)
+		{
+			FRewardTrafficCapture::Start(InArgs.Num() > 0 ? InArgs[0] : FPaths::ProjectSavedDir() / TEXT("Profiling/RewardTraffic.rwtl"));
+		}));
+
+	static FAutoConsoleCommand StopCommand(
+		TEXT("Reward.Capture.Stop"),
+		TEXT("Stop recording reward pipeline traffic and flush the file."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			FRewardTrafficCapture::Stop();
+		}));
+}
+
+bool FRewardTrafficCapture::IsCapturing()
+{
+	return RewardTrafficCapture::bCapturing.load(std::memory_order_relaxed);
+}
+
+bool FRewardTrafficCapture::Start(const FString& InPath)
+{
+	using namespace RewardTrafficCapture;
+
+	Stop();
+
+	FScopeLock ScopeLock(&Lock);
+	File.Reset(IFileManager::Get().CreateFileWriter(*InPath));
+	if (!File)
+	{
+		// 로그 : [RewardCapture] Failed to open %s
+		return false;
+	}
+
+	ImageVersion = 0;
+	Writer.Reset();
+	Writer.WriteFileHeader();
+	bCapturing.store(true, std::memory_order_relaxed);
+
+	// 로그 : [RewardCapture] Recording to %s
+	return true;
+}
+
+void FRewardTrafficCapture::Stop()
+{
+	using namespace RewardTrafficCapture;
+
+	bCapturing.store(false, std::memory_order_relaxed);
+
+	FScopeLock ScopeLock(&Lock);
+	if (!File)
+	{
+		return;
+	}
+
+	Flush();
+	File->Close();
+	File.Reset();
+
+	// 로그 : [RewardCapture] Stopped
+}
+
+RewardCore::FTrafficRecordHeader FRewardTrafficCapture::MakeHeader(const int64 InAccountId, const FEngineRewardRandom* InRandom/* = nullptr*/)
+{
+	RewardCore::FTrafficRecordHeader Header;
+	Header.AccountId = InAccountId;
+	Header.Timestamp = FDateTime::UtcNow().GetTicks();
+	if (InRandom)
+	{
+		Header.RandomSeed = InRandom->GetSeed();
+		Header.RandomCounter = InRandom->GetCounter();
+	}
+	return Header;
+}
+
+void FRewardTrafficCapture::RecordGacha(const FRewardDataSnapshot& InSnapshot, const RewardCore::FTrafficRecordHeader& InHeader, const RewardCore::FGachaTraffic& InTraffic)
+{
+	RewardTrafficCapture::Write(InSnapshot, [&]()
+	{
+		RewardTrafficCapture::Writer.WriteGacha(InHeader, InTraffic);
+	});
+}
+
+void FRewardTrafficCapture::RecordExpand(const FRewardDataSnapshot& InSnapshot, const RewardCore::FTrafficRecordHeader& InHeader, const RewardCore::FExpandTraffic& InTraffic)
+{
+	RewardTrafficCapture::Write(InSnapshot, [&]()
+	{
+		RewardTrafficCapture::Writer.WriteExpand(InHeader, InTraffic);
+	});
+}
+
+void FRewardTrafficCapture::RecordSimulate(const FRewardDataSnapshot& InSnapshot, const RewardCore::FTrafficRecordHeader& InHeader, const RewardCore::FSimulateTraffic& InTraffic)
+{
+	RewardTrafficCapture::Write(InSnapshot, [&]()
+	{
+		RewardTrafficCapture::Writer.WriteSimulate(InHeader, InTraffic);
+	});
+}
+
+void FRewardTrafficCapture::RecordInventoryChange(const int64 InAccountId, const FName& InItemRowName, const int32 InAmountBefore, const int32 InAmount)
+{
+	const FRewardSnapshotPin Snapshot;
+
+	RewardCore::FInventoryTraffic Traffic;
+	Traffic.ItemId = Snapshot->FindItemId(InItemRowName);
+	if (Traffic.ItemId == InvalidRewardRowId)
+	{
+		return;
+	}
+
+	Traffic.Amount = InAmount;
+	Traffic.AmountBefore = InAmountBefore;
+	Traffic.Item = Snapshot->GetItem(Traffic.ItemId);
+
+	const RewardCore::FTrafficRecordHeader Header = MakeHeader(InAccountId);
+	RewardTrafficCapture::Write(*Snapshot, [&]()
+	{
+		RewardTrafficCapture::Writer.WriteInventory(Header, Traffic);
+	});
+}
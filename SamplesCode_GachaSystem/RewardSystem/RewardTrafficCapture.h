@@ -0,0 +1,44 @@
+/**
+ * Reward Traffic Capture
+ *
+ * 라이브 보상 파이프라인 트래픽 기록 (RewardCore/TrafficLog 형식)
+ * - 콘솔 : Reward.Capture.Start [경로] / Reward.Capture.Stop
+ * - 재현 : RewardCore/tools/RewardReplay (엔진 없이 SQLite 게임 DB 대상)
+ * - 레코드는 메모리 버퍼에 누적 후 일정 크기마다 파일로 기록
+ * - 기록 중이 아니면 IsCapturing() 원자 변수 읽기 외 비용 없음
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RewardCore/TrafficLog.h"
+
+class FRewardDataSnapshot;
+class FEngineRewardRandom;
+
+class FRewardTrafficCapture
+{
+public:
+	static bool IsCapturing();
+
+	/**
+	 * 기록 시작 (기존 파일 덮어쓰기, 이미 기록 중이면 먼저 종료)
+	 */
+	static bool Start(const FString& InPath);
+	static void Stop();
+
+	/**
+	 * 레코드 공통 헤더 (계정, 현재 시각, 난수 시드/생성 위치)
+	 */
+	static RewardCore::FTrafficRecordHeader MakeHeader(const int64 InAccountId, const FEngineRewardRandom* InRandom = nullptr);
+
+	// 스냅샷 버전이 바뀌었으면 DataImage 레코드를 먼저 기록
+	static void RecordGacha(const FRewardDataSnapshot& InSnapshot, const RewardCore::FTrafficRecordHeader& InHeader, const RewardCore::FGachaTraffic& InTraffic);
+	static void RecordExpand(const FRewardDataSnapshot& InSnapshot, const RewardCore::FTrafficRecordHeader& InHeader, const RewardCore::FExpandTraffic& InTraffic);
+	static void RecordSimulate(const FRewardDataSnapshot& InSnapshot, const RewardCore::FTrafficRecordHeader& InHeader, const RewardCore::FSimulateTraffic& InTraffic);
+
+	/**
+	 * 아이템 수량 변경 (스냅샷은 내부에서 고정, 행 없는 아이템은 제외)
+	 */
+	static void RecordInventoryChange(const int64 InAccountId, const FName& InItemRowName, const int32 InAmountBefore, const int32 InAmount);
+};
@@ -13,94 +13,24 @@
  */
 
 #include "ServerRewardSystem.h"
+#include "RewardAllocTags.h"
+#include "RewardCoreAdapters.h"
+#include "RewardDataSnapshot.h"
+#include "RewardInventoryLedger.h"
+#include "RewardStageStats.h"
+#include "RewardTrafficCapture.h"
 #include "DataTable/GachaCampaignData.h"
 #include "DataTable/PlayerCharacterData.h"
 #include "DataTable/RewardData.h"
-#include "SaveGame/ContentsAlarmSave.h"
+#include "RewardCore/GachaRoller.h"
+#include "RewardCore/RewardExpander.h"
 #include "Subsystems/RewardManager.h"
 
-/**
- * 픽업 그룹 기반 보상 선택
- *
- * 로직:
- * - 특정 PickupGroup 이상의 모든 보상 수집
- * - 랜덤하게 하나 선택
- *
- * @param RewardData 가챠 보상 데이터
- * @param PickupGroup 최소 픽업 그룹 등급
- * @return 선택된 보상
- */
-FRewardHandler AddPickupReward(const URewardData* InRewardData, const int32 InPickupGroup)
-{
-	if (!InRewardData)
-	{
-		return FRewardHandler(EReward::None, NAME_None, 0);
-	}
-
-	// 조건에 맞는 보상들 수집
-	TArray<const URewardGachaRandomData*> GachaRandomsData;
-	for (const TObjectPtr<URewardGachaRandomData>& Data : InRewardData->GachaRandoms)
-	{
-		if (Data && Data->PickupGroup >= InPickupGroup)
-		{
-			GachaRandomsData.Add(Data);
-		}
-	}
-
-	if (GachaRandomsData.IsEmpty())
-	{
-		// 로그 : [Gacha] No data for PickupGroup >= %d", InPickupGroup;
-		return FRewardHandler(EReward::None, NAME_None, 0);
-	}
-
-	// 랜덤 선택
-	const int32 Index = FMath::RandRange(0, GachaRandomsData.Num() - 1);
-	FRewardHandler Reward = GachaRandomsData[Index]->Reward;
-
-	// 로그 : [Gacha] Pickup reward: %s (PickupGroup=%d)
-	return Reward;
-}
-
-/**
- * 가중치 기반 랜덤 보상 추첨
- *
- * 알고리즘:
- * 1. 1부터 총 가중치 사이의 랜덤 값 생성
- * 2. 누적 가중치가 랜덤 값을 초과하는 첫 번째 보상 선택
- *
- * 예시:
- * - 보상A (가중치 70): 1~70 범위
- * - 보상B (가중치 25): 71~95 범위
- * - 보상C (가중치 5):  96~100 범위
- *
- * @param RewardData 가챠 보상 데이터
- * @param OutPickupGroup 선택된 보상의 픽업 그룹 (출력)
- * @return 선택된 보상
- */
-FRewardHandler RollRandomReward(const URewardData* InRewardData, int32& OutPickupGroup)
-{
-	const int32 RandomNumber{ FMath::RandRange(1, InRewardData->TotalGachaWeight) };
-
-	int32 CurrentWeight = 0;
-	for (const TObjectPtr<URewardGachaRandomData>& GachaReward : InRewardData->GachaRandoms)
-	{
-		CurrentWeight += GachaReward->Weight;
-		if (CurrentWeight >= RandomNumber)
-		{
-			OutPickupGroup = GachaReward->PickupGroup;
-			// 로그 : [Gacha] Random reward: %s (PickupGroup=%d, Weight=%d)
-			return GachaReward->Reward;
-		}
-	}
-
-	// 로그 : [Gacha] RollRandomReward failed
-	return FRewardHandler(EReward::None, NAME_None, 0);
-}
-
 /**
  * 가챠 실행 (서버 측)
  *
  * 핵심 로직:
+ * 0. 보상 데이터 스냅샷 고정 후 판매 중인 캠페인인지 확인 (배너 일정 인덱스)
  * 1. 피티 카운터 로드
  * 2. 각 뽑기마다:
  *    a. 천장(Special Pity) 체크
@@ -116,103 +46,108 @@ FRewardHandler RollRandomReward(const URewardData* InRewardData, int32& OutPicku
  */
 void UServerRewardSystem::OnPostGive_Gacha(const FRewardHandler* InReward)
 {
-	const TObjectPtr<URewardData>& RewardData{ URewardDataTable::FindRow(InReward->TypeRowName) };
-	if (!RewardData)
+	LLM_SCOPE_BYTAG(RewardGrant);
+	const FRewardTraceScope TraceScope(TEXT("OnPostGive_Gacha"), InReward->Amount, AccountID);
+
+	// 지급 완료까지 같은 스냅샷 사용 (도중에 교체되어도 확률 일관성 유지)
+	const FRewardSnapshotPin Snapshot;
+
+	// 트랜잭션 임시 배열은 스레드 아레나에서 할당 (GiveRewards 안쪽 SimulateRewards 등은 중첩 스코프)
+	const RewardCore::FRewardArenaScope ArenaScope;
+
+	const FRewardRowId RewardId{ Snapshot->FindRewardId(InReward->TypeRowName) };
+	if (RewardId == InvalidRewardRowId)
 	{
 		return;
 	}
 
-	// 캠페인 데이터 조회 (피티 설정 포함)
-	const FGachaCampaignData* CampaignData{ nullptr };
-    UGachaCampaignDataTable::Visit([&CampaignData, &RewardData](const FGachaCampaignData* Data)
-    {
-        if (Data->RewardGroupRowName == RewardData->RewardGroupName)
-        {
-            CampaignData = Data;
-        }
-    });
+	const FCompiledRewardData& RewardData{ Snapshot->GetReward(RewardId) };
 
+	// 판매 중인 캠페인 데이터 조회 (피티 설정 포함)
+	const FCompiledGachaCampaign* CampaignData{ nullptr };
+	{
+		const FRewardStageScope StageScope(ERewardStage::CampaignLookup);
+		CampaignData = Snapshot->GetSchedule().FindActiveCampaign(RewardData.RewardGroupName, FDateTime::UtcNow());
+	}
     if (!CampaignData)
     {
+	    // 로그 : [Gacha] Campaign not on sale: %s
 	    return;
     }
 
+	RewardCore::FPityConfig PityConfig;
+	PityConfig.NormalPickupGroup = CampaignData->NormalPickupGroup;
+	PityConfig.SpecialPickupGroup = CampaignData->SpecialPickupGroup;
+	PityConfig.SpecialTryCount = CampaignData->SpecialTryCount;
+
 	// 피티 카운터 로드
-	NormalPickupCounter = 0;
-	SpecialPickupCounter = 0;
-	UContentsAlarmSave::GetGachaCounter(InReward->TypeRowName, NormalPickupCounter, SpecialPickupCounter);
+	FContentsAlarmPityStore PityStore(*Snapshot);
+	RewardCore::FPityState PityState;
+	{
+		const FRewardStageScope StageScope(ERewardStage::PityLoad);
+		PityStore.LoadPity(RewardId, PityState);
+	}
+
+	NormalPickupCounter = PityState.NormalCounter;
+	SpecialPickupCounter = PityState.SpecialCounter;
 
+	// 각 뽑기 실행 (천장 판정/추첨은 코어, 결과는 FPackedReward로 누적)
     const int32 PickupCount = InReward->Amount;
-    if (RewardData->TotalGachaWeight <= 0 || PickupCount <= 0)
-    {
-	    return;
-    }
+	FEngineRewardRandom Random;
+	const RewardCore::FPityState PityBefore = PityState;
+	const RewardCore::FTrafficRecordHeader TrafficHeader = FRewardTrafficCapture::IsCapturing() ? FRewardTrafficCapture::MakeHeader(AccountID, &Random) : RewardCore::FTrafficRecordHeader();
 
-    TArray<FRewardHandler> RewardHandlers;
-    RewardHandlers.Reserve(PickupCount);
+    RewardCore::FPackedRewardArray RewardHandlers(ArenaScope.GetArena());
+	bool bPulled = false;
+	{
+		const FRewardStageScope StageScope(ERewardStage::Roll);
+		bPulled = RewardCore::PullGacha(RewardData, PityConfig, PityState, PickupCount, Random, RewardHandlers);
+	}
 
-	const int32 NormalPickupGroup = CampaignData->NormalPickupGroup;
-	const int32 SpecialPickupGroup = CampaignData->SpecialPickupGroup;
-	const int32 SpecialTryCount = CampaignData->SpecialTryCount;
+	if (FRewardTrafficCapture::IsCapturing())
+	{
+		RewardCore::FGachaTraffic Traffic;
+		Traffic.RewardId = RewardId;
+		Traffic.PullCount = PickupCount;
+		Traffic.Config = PityConfig;
+		Traffic.PityBefore = PityBefore;
+		Traffic.PityAfter = PityState;
+		Traffic.bSucceeded = bPulled;
+		Traffic.Rewards = RewardHandlers;
+		FRewardTrafficCapture::RecordGacha(*Snapshot, TrafficHeader, Traffic);
+	}
 
-	// 각 뽑기 실행
-    for (int32 Index = 0; Index < PickupCount; ++Index)
+    if (!bPulled)
     {
-        TotalPickupCount++;
-        NormalPickupCounter++;
-        SpecialPickupCounter++;
+	    return;
+    }
 
-        bool bSucceed = false;
+	TotalPickupCount += PickupCount;
+	NormalPickupCounter = PityState.NormalCounter;
+	SpecialPickupCounter = PityState.SpecialCounter;
 
-		// 1. Special Pity 체크 (최고 등급 천장)
-        if (SpecialPickupGroup > 0 && SpecialPickupCounter >= SpecialTryCount)
-        {
-        	RewardHandlers.Emplace(AddPickupReward(RewardData, SpecialPickupGroup));
-            SpecialPickupCounter = 0;
-            NormalPickupCounter = 0;
-            bSucceed = true;
-        }
-		// 2. Normal Pity 체크 (10회 천장)
-        else if (NormalPickupGroup > 0 && NormalPickupCounter >= 10)
-        {
-        	RewardHandlers.Emplace(AddPickupReward(RewardData, NormalPickupGroup));
-            NormalPickupCounter = 0;
-            bSucceed = true;
-        }
+	// 보상 지급 (지급 시점에만 FRewardHandler로 변환)
+    if (RewardHandlers.size() == static_cast<size_t>(PickupCount))
+    {
+        TArray<FRewardHandler> GiveHandlers;
+        Snapshot->Unpack(MakeArrayView(RewardHandlers.data(), PickupCount), GiveHandlers);
 
-		// 3. 일반 랜덤 추첨
-        if (!bSucceed)
+        // 지급 트랜잭션 경계 (안쪽 SimulateRewards 예약을 지급 종료 시 정산)
+        FRewardReservationScope ReservationScope;
+        if (URewardManager::GiveRewards(GiveHandlers))
         {
-        	int32 PickupGroup = 0;
-        	FRewardHandler Reward = RollRandomReward(RewardData, PickupGroup);
-        	RewardHandlers.Emplace(Reward);
-
-			// 높은 등급 획득 시 카운터 리셋
-        	if (PickupGroup >= SpecialPickupGroup)
-        	{
-        		SpecialPickupCounter = 0;
-        		NormalPickupCounter = 0;
-        	}
-        	else if (PickupGroup >= NormalPickupGroup)
-        	{
-        		NormalPickupCounter = 0;
-        	}
+            ReservationScope.MarkCommitted();
         }
     }
 
-	// 보상 지급
-    if (RewardHandlers.Num() == PickupCount)
-    {
-        URewardManager::GiveRewards(RewardHandlers);
-    }
-
 	// 피티 카운터 저장
-	const int32 RemainingNormal = 10 - NormalPickupCounter;
-	const int32 RemainingSpecial = SpecialTryCount - SpecialPickupCounter;
+	const int32 RemainingNormal = PityConfig.NormalTryCount - NormalPickupCounter;
+	const int32 RemainingSpecial = PityConfig.SpecialTryCount - SpecialPickupCounter;
 
 	// 로그 : [Reward_Gacha] Normal : %d/10, Special : %d/%d
 
-	UContentsAlarmSave::SetGachaCounter(InReward->TypeRowName, NormalPickupCounter, SpecialPickupCounter);
+	const FRewardStageScope StageScope(ERewardStage::PityStore);
+	PityStore.SavePity(RewardId, PityState);
 }
 
 /**
@@ -228,52 +163,28 @@ bool UServerRewardSystem::BuildRewardData(const URewardData* InRewardData, TArra
 		return false;
 	}
 
-	// 로그 : [Reward] Build %s => StaticCount[%d] RandomCount[%d]
-
-	InRewardHandlers.Reserve(InRewardData->Statics.Num() + InRewardData->Randoms.Num());
-
-	auto AddReward = [&InRewardHandlers](const FRewardHandler& Handler)
-	{
-		// RewardData 타입은 재귀적으로 전개
-		if (Handler.RewardType == EReward::RewardData)
-		{
-			const URewardData* StaticRewardData = URewardDataTable::FindRow(Handler.TypeRowName);
+	LLM_SCOPE_BYTAG(RewardGrant);
+	FRewardStageScope StageScope(ERewardStage::BuildRewardData);
+	const FRewardSnapshotPin Snapshot;
+	const RewardCore::FRewardArenaScope ArenaScope;
 
-			for (int32 i = 0; i < Handler.Amount; ++i)
-			{
-				BuildRewardData(StaticRewardData, InRewardHandlers);
-			}
-		}
-		else
-		{
-			InRewardHandlers.Emplace(RewardHandler);
-		}
-	};
+	// 전개는 코어에서 FPackedReward로 (하위 보상팩도 행 ID로 조회), 결과 반환 시점에만 FRewardHandler로 변환
+	FEngineRewardRandom Random;
+	const FRewardRowId RewardId = Snapshot->FindRewardId(InRewardData->DataRowName);
+	const RewardCore::FTrafficRecordHeader TrafficHeader = FRewardTrafficCapture::IsCapturing() ? FRewardTrafficCapture::MakeHeader(Instance->AccountID, &Random) : RewardCore::FTrafficRecordHeader();
 
-	// 고정 보상 추가
-	for (const FRewardHandler& RewardHandler : InRewardData->Statics)
-	{
-		AddReward(RewardHandler);
-	}
+	RewardCore::FPackedRewardArray PackedHandlers(ArenaScope.GetArena());
+	RewardCore::ExpandReward(*Snapshot, RewardId, Random, PackedHandlers);
 
-	// 랜덤 보상 추첨
-	if (!InRewardData->Randoms.IsEmpty())
+	if (FRewardTrafficCapture::IsCapturing())
 	{
-		const int32 RandomNumber{ FMath::RandRange(1, InRewardData->TotalWeight) };
-		// 로그 : [Reward] %s: Random Start; %d/%d
-
-		int32 CurrentValue = 0;
-		for (const TObjectPtr<URewardRandomData>& Reward : InRewardData->Randoms)
-		{
-			CurrentValue += Reward->Weight;
-			if (CurrentValue >= RandomNumber)
-			{
-				// 로그 : [Reward] Select: %s, CurrentValue: %d
-				AddReward(Reward->Reward);
-				break;
-			}
-		}
+		RewardCore::FExpandTraffic Traffic;
+		Traffic.RewardId = RewardId;
+		Traffic.Rewards = PackedHandlers;
+		FRewardTrafficCapture::RecordExpand(*Snapshot, TrafficHeader, Traffic);
 	}
+	Snapshot->Unpack(MakeArrayView(PackedHandlers.data(), static_cast<int32>(PackedHandlers.size())), InRewardHandlers);
+	StageScope.SetHandlerCount(InRewardHandlers.Num());
 
 	return !InRewardHandlers.IsEmpty();
 }
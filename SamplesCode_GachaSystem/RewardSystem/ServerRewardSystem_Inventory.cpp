@@ -13,12 +13,19 @@
  */
 
 #include "ServerRewardSystem.h"
+#include "RewardAllocTags.h"
+#include "RewardCoreAdapters.h"
+#include "RewardDataSnapshot.h"
+#include "RewardInventoryLedger.h"
+#include "RewardStageStats.h"
+#include "RewardTrafficCapture.h"
 #include "Common/SqliteUtil.h"
 #include "DataTable/ItemDataTable.h"
 #include "DataTable/ItemToolData.h"
 #include "DataTable/ItemValuableData.h"
 #include "Network/UserData_Equipment.h"
 #include "Network/UserData_Inventory.h"
+#include "RewardCore/SlotSimulator.h"
 
 /**
  * 보상 시뮬레이션 (실제 지급 전 검증)
@@ -29,173 +36,149 @@
  * - 트랜잭션 롤백 방지
  *
  * 알고리즘:
- * 1. 스택 가능 아이템 병합
- * 2. 현재 인벤토리 슬롯 수 계산
- * 3. 추가될 슬롯 수 예측
- * 4. 최대 용량 초과 여부 확인
+ * 1. 스택 가능 아이템 병합 (이름 → 행 ID는 여기서 1회, 병합/슬롯 계산은 RewardCore)
+ * 2. 보상별 검증 (URewardManager::Simulate, 첫 실패에서 중단)
+ * 3. 현재 인벤토리 슬롯 수 계산 (반영분 + 같은 계정의 진행 중 예약분)
+ * 4. 추가될 슬롯 수 예측, 최대 용량 초과 여부 확인 (검증 결과와 함께 입력 순서대로)
+ * 5. 통과 시 슬롯/스택 여유분 예약 (FRewardInventoryLedger, 예약 스코프 안에서만)
+ * 3~5만 계정 예약 원장 잠금 안에서 수행 (검증/캡처 기록은 잠금 밖)
  */
 bool UServerRewardSystem::SimulateRewards(TArray<FRewardHandler>& InRewards, const TArray<UNetItem*>& InUpdatedItem, const bool bCheckInventory/* = true*/)
 {
+	LLM_SCOPE_BYTAG(RewardInventory);
+	const FRewardStageScope StageScope(ERewardStage::SimulateRewards, InRewards.Num());
 	const ERewardSource DefaultSource = InRewards.Num() > 0 ? InRewards[0].AcquireSource : ERewardSource::None;
 
-    TArray<FRewardHandler> NonStackablePass;
-    TMap<FName, int32> StackableCounts;
+	// 아이템 메타데이터는 스냅샷에서 조회 (테이블 교체 중에도 일관성 유지)
+	const FRewardSnapshotPin Snapshot;
 
-	// 1. 아이템 분류 및 병합
+	// 분류/병합 배열은 스레드 아레나에서 할당 (바깥 트랜잭션 배열은 이 함수 동안 커지지 않음)
+	const RewardCore::FRewardArenaScope ArenaScope;
+
+	// 아이템 보상은 FPackedReward(행 ID 포함)로 분류/병합 후 마지막에 한 번만 FRewardHandler로 변환
+    RewardCore::FPackedRewardArray ItemPass(ArenaScope.GetArena());
+    ItemPass.reserve(InRewards.Num());
+
+	// 1. 아이템 분류 (이름 → 행 ID는 여기서 1회)
+    int32 KeptNum = 0;
     for (int32 i = 0; i < InRewards.Num(); ++i)
     {
         const FRewardHandler& Reward = InRewards[i];
-        if (Reward.RewardType != EReward::Item)
+        const FRewardRowId ItemId = Reward.RewardType == EReward::Item ? Snapshot->FindItemId(Reward.TypeRowName) : InvalidRewardRowId;
+        if (ItemId == InvalidRewardRowId)
 		{
+            // 아이템이 아니거나 ItemData 없음 → 그대로 유지
+            InRewards[KeptNum++] = Reward;
             continue;
 		}
 
-        const FItemBaseData* ItemData = UItemDataTable::FindRow<FItemBaseData>(Reward.TypeRowName);
-        if (!ItemData)
-        {
-            // 로그 : ItemData not found: %s
-            continue;
-        }
-
-		// 스택 불가능 아이템 (무기, 방어구 등)
-        if (ItemData->IsNonStackable())
-        {
-            NonStackablePass.Add(Reward);
-            InRewards.RemoveAt(i--, EAllowShrinking::No);
-        }
-		// 스택 가능 아이템 (소비 아이템 등) - 병합
-        else
-        {
-            StackableCounts.FindOrAdd(Reward.TypeRowName) += Reward.Amount;
-            InRewards.RemoveAt(i--, EAllowShrinking::No);
-        }
+        Snapshot->Pack(Reward, ItemPass.emplace_back());
     }
+    InRewards.SetNum(KeptNum, EAllowShrinking::No);
 
-	// 2. 병합된 아이템 재구성
-    for (const auto& Pair : StackableCounts)
+	// 2. 스택 가능 아이템 병합 후 재구성 (InRewards[KeptNum..]와 같은 순서)
+    RewardCore::FPackedRewardArray PackedItems(ArenaScope.GetArena());
+    RewardCore::MergeItemRewards(*Snapshot, ItemPass.data(), ItemPass.size(), static_cast<uint8>(DefaultSource), PackedItems);
+    Snapshot->Unpack(MakeArrayView(PackedItems.data(), static_cast<int32>(PackedItems.size())), InRewards);
+
+	// 3. 보상별 검증 (원장 잠금 전, 실패 위치는 아래에서 입력 순서대로 판정)
+    int32 FailedIndex = INDEX_NONE;
+    for (int32 RewardIndex = 0; RewardIndex < InRewards.Num(); ++RewardIndex)
     {
-        const FName ItemRowName = Pair.Key;
-        const int32 Amount = Pair.Value;
-        if (Amount != 0)
+        if (!URewardManager::Simulate(&InRewards[RewardIndex]))
         {
-            InRewards.Emplace(EReward::Item, ItemRowName, Amount, DefaultSource);
+            FailedIndex = RewardIndex;
+            break;
         }
     }
-    InRewards.Append(NonStackablePass);
 
-	// 3. 현재 인벤토리 슬롯 계산
-    int32 SlotAmount = UUserData_Inventory::GetItemSlotCount();
+    const bool bCapture = FRewardTrafficCapture::IsCapturing();
+    RewardCore::FSimulateTraffic Traffic;
+    RewardCore::ESimulateOutcome Outcome = bCheckInventory ? RewardCore::ESimulateOutcome::Passed : RewardCore::ESimulateOutcome::Unchecked;
+    bool bSucceeded = true;
 
-	// 4. 업데이트될 아이템의 슬롯 영향 계산
-    for (const auto& It : InUpdatedItem)
+	// 계정 원장 잠금 구간 (판정과 예약 사이에 같은 계정의 다른 예약이 끼어들지 않음)
     {
-        if (!It || !It->ItemData)
-        {
-	        continue;
-        }
-        if (!It->ItemData->RequiresInventorySlot())
-        {
-	        continue;
-        }
-
-		// 스택 불가능 아이템
-        if (It->ItemData->IsNonStackable())
+	    // 4. 현재 인벤토리 슬롯 계산 (반영분 + 예약분, 캡처 중이면 조회한 보유 수량 기록)
+        const FUserInventoryView Inventory(*Snapshot);
+        RewardCore::FInventoryLedger::FLedgerView LedgerView(FRewardInventoryLedger::Get(), static_cast<uint64>(AccountID), Inventory);
+        const RewardCore::FRecordingInventoryView RecordingInventory(LedgerView, Traffic.Amounts);
+        RewardCore::FSlotSimulator Slots(bCapture ? static_cast<const RewardCore::IInventoryView&>(RecordingInventory) : LedgerView);
+
+	    // 5. 업데이트될 아이템의 슬롯 영향 계산
+        for (const auto& It : InUpdatedItem)
         {
-            if (It->Amount > 0)
+            const FRewardRowId PendingItemId = It ? Snapshot->FindItemIdByItemID(It->ItemID) : InvalidRewardRowId;
+            if (PendingItemId == InvalidRewardRowId)
             {
-	            SlotAmount += It->Amount;  // 추가
+	            continue;
             }
-            else if (It->Amount < 0)
-            {
-	            SlotAmount -= FMath::Abs(It->Amount);  // 제거
-            }
-        }
-		// 스택 가능 아이템
-        else
-        {
-            SlotAmount += (It->Amount > 0 ? 1 : -1);
-        }
-    }
 
-    const int32 MaxCapacity = UUserData_Inventory::GetMaxCapacity();
-
-	// 5. 추가될 아이템의 슬롯 영향 예측
-    for (const FRewardHandler& Reward : InRewards)
-    {
-        if (!URewardManager::Simulate(&Reward))
-        {
-            // 로그 : %s Simulate Fail
-            return false;
-        }
-
-        if (!bCheckInventory)
-        {
-        	continue;
-        }
-
-        if (Reward.RewardType != EReward::Item || Reward.AcquireSource != ERewardSource::None)
-        {
-        	continue;
+            Slots.AddPendingChange(Snapshot->GetItem(PendingItemId), It->Amount);
         }
 
-        const FItemBaseData* ItemData = UItemDataTable::FindRow<FItemBaseData>(Reward.TypeRowName);
-        if (!ItemData)
+        if (bCapture)
         {
-            // 로그 : ItemData not found: %s
-            continue;
+            Traffic.SlotCount = Slots.GetSlotCount();
+            Traffic.MaxCapacity = LedgerView.GetMaxCapacity();
         }
 
-        if (!ItemData->RequiresInventorySlot())
+	    // 6. 검증 결과 확인 + 추가될 아이템의 용량 초과 체크 (입력 순서)
+        for (int32 RewardIndex = 0; RewardIndex < InRewards.Num(); ++RewardIndex)
         {
-        	continue;
-        }
-
-        const int32 UserAmount = UUserData_Inventory::GetAmount(Reward.TypeRowName);
+            const FRewardHandler& Reward = InRewards[RewardIndex];
+            if (RewardIndex == FailedIndex)
+            {
+                // 로그 : %s Simulate Fail
+                Outcome = RewardCore::ESimulateOutcome::Unchecked;
+                bSucceeded = false;
+                break;
+            }
 
-		// 스택 불가능 아이템
-        if (ItemData->IsNonStackable())
-        {
-            if (Reward.Amount > 0)
+            if (!bCheckInventory)
             {
-                SlotAmount += Reward.Amount;
+        	    continue;
             }
-            else if (Reward.Amount < 0)
+
+            if (Reward.RewardType != EReward::Item || Reward.AcquireSource != ERewardSource::None)
             {
-                const int32 Decrease = FMath::Min(UserAmount, -Reward.Amount);
-                SlotAmount -= Decrease;
+        	    continue;
             }
-        }
-		// 스택 가능 아이템
-        else
-        {
-            if (Reward.Amount > 0)
+
+            const FRewardRowId ItemId = RewardIndex >= KeptNum ? PackedItems[RewardIndex - KeptNum].Id : InvalidRewardRowId;
+            if (ItemId == InvalidRewardRowId)
             {
-				// 새로운 아이템이면 슬롯 +1
-                if (UserAmount == 0)
-                {
-                    ++SlotAmount;
-                }
-				// 기존 아이템에 스택 (슬롯 변화 없음)
+                // 로그 : ItemData not found: %s
+                continue;
             }
-            else if (Reward.Amount < 0)
+
+            if (!Slots.AddReward(Snapshot->GetItem(ItemId), ItemId, Reward.Amount))
             {
-				// 아이템이 완전히 소진되면 슬롯 -1
-                if (UserAmount + Reward.Amount <= 0)
-                {
-                    --SlotAmount;
-                }
+                // 로그 : Inventory Full;
+                Outcome = RewardCore::ESimulateOutcome::InventoryFull;
+                bSucceeded = false;
+                break;
             }
         }
 
-		// 6. 용량 초과 체크
-        if (SlotAmount > MaxCapacity)
+	    // 7. 통과한 아이템 슬롯/스택 여유분 예약 (트랜잭션 종료 시 정산, 스코프 밖이면 판정만)
+        if (bSucceeded && bCheckInventory && FRewardReservationScope::IsOpen())
         {
-            // 로그 : Inventory Full;
-            return false;
+            FRewardReservationScope::Add(LedgerView.Reserve(*Snapshot, PackedItems.data(), PackedItems.size()));
         }
     }
 
-    return true;
+	// 캡처 기록은 원장 잠금 해제 후
+    if (bCapture)
+    {
+        Traffic.AcquireSource = static_cast<uint8>(DefaultSource);
+        Traffic.Items = ItemPass;
+        Traffic.Merged = PackedItems;
+        Traffic.Outcome = Outcome;
+        FRewardTrafficCapture::RecordSimulate(*Snapshot, FRewardTrafficCapture::MakeHeader(AccountID), Traffic);
+    }
+
+    return bSucceeded;
 }
 
 /**
@@ -208,8 +191,20 @@ bool UServerRewardSystem::SimulateRewards(TArray<FRewardHandler>& InRewards, con
  */
 UNetItem* UServerRewardSystem::AddInventoryItem(const int32 InItemID, const int32 InAddAmount, FSqliteQueryTask* InTask)
 {
-	const FItemBaseData* ItemData{ UItemDataTable::FindRow(InItemID) };
-	const bool bCanStack = ItemData->MaxStackAmount > 1;
+	// BuildOptions 구간 포함 (NewObject<UNetItem> 포함)
+	LLM_SCOPE_BYTAG(RewardInventory);
+	const FRewardStageScope StageScope(ERewardStage::AddInventoryItem);
+
+	// 스택 판정/이름은 스냅샷 (아이템 ID 인덱스)
+	const FRewardSnapshotPin Snapshot;
+	const FRewardRowId ItemRowId = Snapshot->FindItemIdByItemID(InItemID);
+	if (ItemRowId == InvalidRewardRowId)
+	{
+		// 로그 : [Inventory] Unknown ItemID %d
+		return nullptr;
+	}
+
+	const bool bCanStack = Snapshot->GetItem(ItemRowId).MaxStackAmount > 1;
 	UNetItem* NetItem = bCanStack ? DuplicateNetItemByID(InItemID) : nullptr;
 
 	// 스택 가능하고 기존 아이템이 있으면 수량만 증가
@@ -223,7 +218,16 @@ UNetItem* UServerRewardSystem::AddInventoryItem(const int32 InItemID, const int3
 	NetItem = NewObject<UNetItem>(this);
 	NetItem->ItemID = InItemID;
 	NetItem->Amount = InAddAmount;
-	NetItem->ItemData = ItemData;
+
+	// UNetItem 원본 행 (장비 서브 옵션 생성/클라이언트 표시용, 새 아이템 생성 시에만 조회)
+	NetItem->ItemData = UItemDataTable::FindRow(InItemID);
+
+	if (FRewardTrafficCapture::IsCapturing())
+	{
+		const FName& ItemRowName = Snapshot->GetItemName(ItemRowId);
+		FRewardTrafficCapture::RecordInventoryChange(AccountID, ItemRowName, UUserData_Inventory::GetAmount(ItemRowName), InAddAmount);
+	}
+
 	NetItem->ItemUID = Sqlite::QueryGameDB(SqlGameQuery::InsertItem, AccountID, NetItem->ItemID, NetItem->Amount)->GetLastInsertRowId();
 	NetItem->CreateDate = FDateTime::Now();
 
@@ -239,6 +243,8 @@ UNetItem* UServerRewardSystem::AddInventoryItem(const int32 InItemID, const int3
  */
 bool UServerRewardSystem::RemoveInventoryItem(UNetItem* InNetItem, const int32 InRemoveAmount, FSqliteQueryTask* InTask)
 {
+	LLM_SCOPE_BYTAG(RewardInventory);
+
 	if (!InNetItem || InRemoveAmount < 0 || InNetItem->Amount - InRemoveAmount < 0)
 	{
 		return false;
@@ -265,9 +271,21 @@ bool UServerRewardSystem::RemoveInventoryItem(UNetItem* InNetItem, const int32 I
  */
 void UServerRewardSystem::OnUpdateItemAmount(UNetItem* InNetItem, const int32 InUpdateAmount, FSqliteQueryTask* Task)
 {
-	const FItemBaseData* ItemData{ UItemDataTable::FindRow(InNetItem->ItemID) };
+	const FRewardSnapshotPin Snapshot;
+	const FRewardRowId ItemRowId = Snapshot->FindItemIdByItemID(InNetItem->ItemID);
+	if (ItemRowId == InvalidRewardRowId)
+	{
+		// 로그 : [Inventory] Unknown ItemID %d
+		return;
+	}
+
 	const int32 PreAmount = InNetItem->Amount;
-	InNetItem->Amount = FMath::Clamp(PreAmount + InUpdateAmount, 0, ItemData->MaxStackAmount);
+	InNetItem->Amount = FMath::Clamp(PreAmount + InUpdateAmount, 0, Snapshot->GetItem(ItemRowId).MaxStackAmount);
+
+	if (FRewardTrafficCapture::IsCapturing())
+	{
+		FRewardTrafficCapture::RecordInventoryChange(AccountID, Snapshot->GetItemName(ItemRowId), PreAmount, InNetItem->Amount - PreAmount);
+	}
 
 	if (InNetItem->Amount > 0)
 	{
@@ -295,6 +313,8 @@ void UServerRewardSystem::BuildOptions(UNetItem* InNetItem, FSqliteQueryTask* In
 		return;
 	}
 
+	const FRewardStageScope StageScope(ERewardStage::BuildOptions);
+
 	TArray<TObjectPtr<UEquipmentSubOptionData>> Options;
 	UEquipmentSubOptionDataTable::BuildOptions(static_cast<const FEquipmentData*>(InNetItem->ItemData), Options);
 	InNetItem->Options.Empty(Options.Num());
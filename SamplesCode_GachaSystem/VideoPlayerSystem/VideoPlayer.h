@@ -18,6 +18,10 @@
 
 #include "CoreMinimal.h"
 #include "Tickable.h"
+#include "Containers/Ticker.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "Tasks/Task.h"
+#include <atomic>
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "VideoPlayer.generated.h"
 
@@ -25,9 +29,14 @@ struct FVideoResourceData;
 class UFileMediaSource;
 class UMediaPlayer;
 class UMediaSource;
+class UMediaTexture;
 class USoundClass;
 class USoundMix;
 
+// 할당 추적 LLM 태그 (재생 요청 / 자막 파싱), Reward.AllocStats 콘솔로 함께 조회
+LLM_DECLARE_TAG(VideoPlayer);
+LLM_DECLARE_TAG(VideoSubtitle);
+
 // 델리게이트 선언
 DECLARE_DYNAMIC_DELEGATE(FOnVideoPlaybackEnd);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSingleVideoEnd, int32, VideoIndex);
@@ -78,6 +87,25 @@ struct FVideoPlayHandler
 	FVideoOptionalData VideoOptionalData{};
 };
 
+/**
+ * 큐 재생 그래프 노드
+ * PlayVideos에서 큐를 한 번 컴파일하여 전환 시 O(1) 조회
+ */
+struct FVideoPlaybackNode
+{
+	// 재생 종료 시 다음 인덱스 (Prologue → 같은 그룹 Loop, 그 외 → 다음 비루프)
+	int32 NextIndex{ INDEX_NONE };
+
+	// 같은 그룹의 Loop 인덱스 (바로 뒤에 Loop가 있는 Prologue만)
+	int32 LoopPartnerIndex{ INDEX_NONE };
+
+	// 스킵 시 이동 인덱스 (자신의 Loop를 건너뛴 다음 비루프)
+	int32 SkipTargetIndex{ INDEX_NONE };
+
+	// 요약 모드 이동 인덱스 (이후 첫 번째 필수 재생(bForcePlay) 항목)
+	int32 NextForcedIndex{ INDEX_NONE };
+};
+
 /**
  * 자막 큐 (SRT 포맷)
  */
@@ -99,13 +127,93 @@ public:
 	bool IsInTime(const FTimespan& Time) const;
 };
 
+/**
+ * 미디어 소스 캐시 키 (GroupID + Loop 여부)
+ */
+USTRUCT()
+struct FVideoMediaSourceKey
+{
+	GENERATED_BODY()
+
+	FVideoMediaSourceKey() = default;
+	FVideoMediaSourceKey(const FName InGroupID, const bool bInLoop) : GroupID(InGroupID), bLoop(bInLoop) {}
+
+	UPROPERTY()
+	FName GroupID{ NAME_None };
+
+	UPROPERTY()
+	bool bLoop{ false };
+
+	bool operator==(const FVideoMediaSourceKey& Other) const
+	{
+		return GroupID == Other.GroupID && bLoop == Other.bLoop;
+	}
+
+	friend uint32 GetTypeHash(const FVideoMediaSourceKey& Key)
+	{
+		return HashCombineFast(GetTypeHash(Key.GroupID), static_cast<uint32>(Key.bLoop));
+	}
+};
+
+/**
+ * 미디어 소스 캐시 항목
+ */
+USTRUCT()
+struct FCachedMediaSourceEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<UFileMediaSource> MediaSource{ nullptr };
+
+	// 원본 파일 크기 (byte, INDEX_NONE: 아직 모름 → 제거 판정 시 확인)
+	int64 FileSize{ INDEX_NONE };
+
+	// 마지막 조회 순번 (LRU)
+	uint64 LastAccess{ 0 };
+};
+
+/**
+ * 미디어 소스 캐시 통계
+ */
+USTRUCT(BlueprintType)
+struct FVideoMediaSourceCacheStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly)
+	int32 Hits{ 0 };
+
+	UPROPERTY(BlueprintReadOnly)
+	int32 Misses{ 0 };
+
+	UPROPERTY(BlueprintReadOnly)
+	int32 Evictions{ 0 };
+
+	UPROPERTY(BlueprintReadOnly)
+	int32 Num{ 0 };
+
+	UPROPERTY(BlueprintReadOnly)
+	int64 Bytes{ 0 };
+};
+
+/**
+ * 자막 동기화 방식
+ */
+UENUM()
+enum class ESubtitleTimingMode : uint8
+{
+	Scheduled,	// 다음 큐 경계 시점에만 깨어나 갱신
+	Polling,	// 매 프레임 Tick 폴링 (미디어 클럭이 불안정할 때의 폴백)
+};
+
 /**
  * 자막 시스템
  *
  * 핵심 기능:
  * - SRT 파일 파싱
  * - 비디오 재생과 실시간 동기화
- * - FTickableGameObject를 통한 매 프레임 업데이트
+ * - 다음 큐 경계 시점 예약 갱신 (미디어 클럭 불안정 시 Tick 폴링으로 폴백)
  */
 UCLASS()
 class  USubtitle : public UObject, public FTickableGameObject
@@ -135,6 +243,12 @@ public:
 	void Play(UMediaPlayer* Player);
 	void Stop();
 
+	/**
+	 * 예약 갱신 사용 여부
+	 * false면 항상 매 프레임 Tick 폴링
+	 */
+	void SetUseScheduledTiming(const bool bEnable) { bUseScheduledTiming = bEnable; }
+
 	// FTickableGameObject Interface
 	virtual void Tick(float DeltaTime) override;
 	virtual bool IsTickable() const override;
@@ -142,10 +256,182 @@ public:
 	virtual bool IsTickableWhenPaused() const override;
 	virtual TStatId GetStatId() const override;
 
+private:
+	// 미디어 클럭 이벤트 (재생 재개/중단/탐색 시 다음 경계 재계산)
+	UFUNCTION()
+	void OnMediaClockChanged();
+
+	/**
+	 * 현재 시간 기준으로 자막 표시/숨김 1단계 처리
+	 */
+	void UpdateCue(const FTimespan& CurrentTime);
+
+	/**
+	 * 다음 큐 경계(시작 또는 종료)까지의 시간을 계산해 한 번만 깨어나도록 예약
+	 * 미디어 클럭을 신뢰할 수 없으면 Tick 폴링으로 전환
+	 */
+	void ScheduleNextBoundary();
+	void ClearSchedule();
+
+	bool OnScheduledBoundary(float DeltaTime);
+	bool IsMediaClockReliable() const;
+
+	void BindMediaClockEvents(UMediaPlayer* Player);
+	void UnbindMediaClockEvents();
+
 private:
 	TWeakObjectPtr<UMediaPlayer> VideoPlayer;
 	int32 CurrentIndex = 0;
 	bool bIsShowingNarration = false;
+
+	bool bUseScheduledTiming = true;
+	ESubtitleTimingMode TimingMode{ ESubtitleTimingMode::Scheduled };
+	FTSTicker::FDelegateHandle ScheduleHandle;
+
+	// 예약 시점에 클럭이 진행하지 않은 횟수 (버퍼링 등)
+	int32 StalledWakeCount = 0;
+	FTimespan LastWakeTime{ 0 };
+
+	// 연속 정체 허용 횟수 (초과 시 폴링 폴백)
+	static constexpr int32 MaxStalledWakeCount = 3;
+};
+
+/**
+ * 큐 영상 파일 사전 읽기 (Readahead)
+ *
+ * 핵심 기능:
+ * - 다음 N개 영상 파일을 바이트 예산 내에서 백그라운드로 OS 페이지 캐시에 적재
+ * - Unix 계열: posix_fadvise(WILLNEED)로 커널 비동기 readahead 요청
+ * - 그 외: 청크 단위 비동기 읽기
+ * - 큐 리셋/스킵 시 취소
+ */
+class FVideoFilePrefetcher
+{
+public:
+	~FVideoFilePrefetcher();
+
+	/**
+	 * 파일 목록 사전 읽기 요청 (이미 요청된 파일은 제외)
+	 * @param InFilePaths 재생 예정 순서의 파일 경로
+	 * @param InByteBudget 이번 요청에서 읽을 최대 바이트
+	 */
+	void Prefetch(const TArray<FString>& InFilePaths, const int64 InByteBudget);
+
+	/**
+	 * 사전 읽기 시 확인한 파일 크기 (없으면 INDEX_NONE)
+	 */
+	int64 FindFileSize(const FString& InPath) const;
+
+	/**
+	 * 진행 중인 읽기 취소 및 요청 기록 초기화
+	 */
+	void Cancel();
+
+private:
+	static void PrefetchFile(const FString& InPath, const int64 InBytes, const std::atomic<bool>& bCancelled);
+
+	TSharedPtr<std::atomic<bool>, ESPMode::ThreadSafe> CancelFlag;
+	UE::Tasks::FTask Task;
+
+	// 현재 큐에서 이미 요청한 파일
+	TSet<FString> RequestedPaths;
+
+	// 확인한 파일 크기 (취소 후에도 유지)
+	TMap<FString, int64> FileSizes;
+};
+
+/**
+ * 비디오 파이프라인 계측 구간
+ */
+enum class EVideoLatencyStage : uint8
+{
+	Open,				// PlayVideo → OnMediaOpened
+	Decode,				// OnMediaOpened → 첫 프레임
+	TimeToFirstFrame,	// PlayVideo → 첫 프레임
+	Playback,			// 첫 프레임 → OnMediaPlaybackEnd
+	Dispatch,			// OnMediaPlaybackEnd → 다음 PlayVideoAtIndex
+	TransitionGap,		// OnMediaPlaybackEnd → 다음 영상 첫 프레임 (화면 공백)
+	Num
+};
+
+/**
+ * 지연 시간 히스토그램 (ms, 2의 거듭제곱 버킷)
+ */
+struct FVideoLatencyHistogram
+{
+	// [0,1) [1,2) [2,4) ... [16384, ∞) ms
+	static constexpr int32 NumBuckets = 16;
+
+	uint32 Buckets[NumBuckets]{};
+	uint32 Count{ 0 };
+	double SumMs{ 0.0 };
+	double MaxMs{ 0.0 };
+
+	void Add(const double InMs);
+
+	/**
+	 * 백분위 값 (해당 버킷 상한으로 근사)
+	 * @param InPercentile 0~1
+	 */
+	double GetPercentile(const double InPercentile) const;
+
+	static double GetBucketUpperBound(const int32 InBucket);
+};
+
+/**
+ * 비디오 파이프라인 지연 계측
+ *
+ * 핵심 기능:
+ * - PlayVideo → OnMediaOpened → 첫 프레임 → OnMediaPlaybackEnd → 다음 PlayVideoAtIndex 구간 측정
+ * - GroupID별 구간 히스토그램
+ * - False End / 오픈 실패 횟수
+ * - Stat 카운터 및 JSON 덤프
+ */
+class FVideoPipelineTelemetry
+{
+public:
+	void OnPlayRequested(const FName& InGroupID);
+	void OnOpened();
+	void OnFirstFrame();
+	void OnPlaybackEnd();
+	void OnNextVideoRequested();
+	void OnFalseEnd();
+	void OnEarlyEnd();
+	void OnOpenFailed();
+	void OnSequenceEnd();
+
+	bool IsWaitingFirstFrame() const { return OpenedTime > 0.0 && FirstFrameTime <= 0.0; }
+
+	/**
+	 * 누적 데이터를 JSON 문자열로 변환
+	 */
+	FString ToJson() const;
+	void Reset();
+
+private:
+	void Record(const EVideoLatencyStage InStage, const double InStartTime, const double InEndTime);
+
+	struct FGroupStats
+	{
+		FVideoLatencyHistogram Stages[static_cast<int32>(EVideoLatencyStage::Num)];
+	};
+
+	TMap<FName, FGroupStats> Groups;
+	FName CurrentGroupID{ NAME_None };
+
+	// 현재 영상 구간 시각 (FPlatformTime::Seconds, 0: 미도달)
+	double PlayRequestTime{ 0.0 };
+	double OpenedTime{ 0.0 };
+	double FirstFrameTime{ 0.0 };
+
+	// 직전 영상 종료 시각 (다음 영상 전환 공백 측정용)
+	double PlaybackEndTime{ 0.0 };
+	FName EndedGroupID{ NAME_None };
+
+	uint32 PlayCount{ 0 };
+	uint32 FalseEndCount{ 0 };
+	uint32 EarlyEndCount{ 0 };
+	uint32 OpenFailCount{ 0 };
 };
 
 /**
@@ -165,6 +451,7 @@ class UVideoPlayer : public UGameInstanceSubsystem
 
 	static inline UVideoPlayer* Instance = nullptr;
 	TUniquePtr<FPlayerBlockHandler> BlockHandler{ nullptr };
+	TUniquePtr<FVideoFilePrefetcher> Prefetcher{ nullptr };
 
 private:
 	bool bOpenVideo{ false };
@@ -181,6 +468,14 @@ public:
 	UPROPERTY(EditAnywhere)
 	TObjectPtr<UMediaPlayer> MediaPlayer;
 
+	// 다음 큐 영상 사전 오픈용 보조 플레이어 (재생 종료 시 MediaPlayer와 교체, MediaTexture 필요)
+	UPROPERTY(EditAnywhere)
+	TObjectPtr<UMediaPlayer> PreloadMediaPlayer;
+
+	// 플레이어 교체 시 출력 대상 갱신용 텍스처 (미설정 시 사전 오픈 비활성)
+	UPROPERTY(EditAnywhere)
+	TObjectPtr<UMediaTexture> MediaTexture;
+
 	UPROPERTY(EditAnywhere)
 	TSubclassOf<UUserWidget> MediaWidgetClass;
 
@@ -203,6 +498,29 @@ public: // Audio Focus
 	UPROPERTY(EditDefaultsOnly, Category="Video|Audio Focus")
 	float UIFocusFadeTime{ 0.2f };
 
+public: // Subtitle
+	// 자막 경계 시점 예약 갱신 (false: 매 프레임 폴링)
+	UPROPERTY(EditDefaultsOnly, Category="Video|Subtitle")
+	bool bScheduledSubtitleTiming{ true };
+
+public: // Media Source Cache
+	// 캐시 항목 수 상한 (최대 시퀀스 1개 이상, 예 : 10연차 30개 이상 / 실제 제한은 용량 상한)
+	UPROPERTY(EditDefaultsOnly, Category="Video|Cache", meta=(ClampMin="1"))
+	int32 MaxCachedMediaSources{ 128 };
+
+	// 캐시된 소스 파일 크기 합 상한 (byte, 0: 무제한)
+	UPROPERTY(EditDefaultsOnly, Category="Video|Cache", meta=(ClampMin="0"))
+	int64 MaxCachedMediaSourceBytes{ 4LL * 1024 * 1024 * 1024 };
+
+public: // Prefetch
+	// 현재 영상 이후 사전 읽기할 파일 수 (0: 사용 안 함)
+	UPROPERTY(EditDefaultsOnly, Category="Video|Prefetch", meta=(ClampMin="0"))
+	int32 PrefetchVideoCount{ 3 };
+
+	// 한 번에 사전 읽기할 최대 바이트
+	UPROPERTY(EditDefaultsOnly, Category="Video|Prefetch", meta=(ClampMin="0"))
+	int64 PrefetchByteBudget{ 256LL * 1024 * 1024 };
+
 private:
 	bool bVideoAudioFocusActive = false;
 
@@ -220,17 +538,34 @@ private:
 	UPROPERTY(Transient)
 	TArray<FVideoPlayHandler> VideoQueue;
 
-	// 미디어 소스 캐싱
+	// 미디어 소스 캐싱 (LRU)
 	UPROPERTY(Transient)
-	TMap<FName, TObjectPtr<UFileMediaSource>> CachedMediaSource;
+	TMap<FVideoMediaSourceKey, FCachedMediaSourceEntry> CachedMediaSource;
+
+	uint64 MediaSourceAccessSerial{ 0 };
+	FVideoMediaSourceCacheStats MediaSourceCacheStats;
 
 	int32 CurrentVideoIndex{ INDEX_NONE };
 	int32 MaxVideoIndex{ INDEX_NONE };
 
+	// VideoQueue와 같은 인덱스의 전환 테이블
+	TArray<FVideoPlaybackNode> PlaybackGraph;
+
+	// 요약 모드 (필수 재생 영상만 재생)
+	bool bSummaryMode{ false };
+
 	EUIName VideoPlayer{ EUIName::VideoPlayer };	
 
 	float LastPlayStartTime{ 0.f };
 
+	// 사전 오픈 중인 큐 인덱스 (INDEX_NONE: 없음)
+	int32 PreloadVideoIndex{ INDEX_NONE };
+	bool bPreloadReady{ false };
+
+	// 파이프라인 지연 계측
+	FVideoPipelineTelemetry Telemetry;
+	FTSTicker::FDelegateHandle FirstFrameProbeHandle;
+
 public:
 	static UVideoPlayer* Get() { return Instance; }
 
@@ -274,6 +609,14 @@ public:
 	UFUNCTION(BlueprintCallable)
 	static void SkipToNextVideo();
 
+	/**
+	 * 요약 모드로 전환
+	 * 남은 큐에서 필수 재생(bForcePlay) 영상만 재생하고,
+	 * 건너뛴 영상은 미디어를 열지 않고 종료 이벤트만 일괄 발행
+	 */
+	UFUNCTION(BlueprintCallable)
+	static void SkipToSummary();
+
 	UFUNCTION(BlueprintCallable)
 	static void CloseVideo();
 
@@ -283,6 +626,22 @@ public:
 	UFUNCTION(BlueprintCallable, meta=(ArrayParam="OutHandlers"))
 	static void ConvertToHandlers(const FVideoResourceData& InResourceData, UPARAM(Ref) TArray<FVideoPlayHandler>& OutHandlers);
 
+	/**
+	 * 미디어 소스 캐시 적중/미스/제거 통계
+	 */
+	UFUNCTION(BlueprintPure)
+	static FVideoMediaSourceCacheStats GetMediaSourceCacheStats();
+
+	/**
+	 * 파이프라인 지연 계측 데이터 (JSON)
+	 * @param bWriteToFile true면 Saved/Profiling 폴더에도 기록
+	 */
+	UFUNCTION(BlueprintCallable)
+	static FString DumpVideoTelemetry(const bool bWriteToFile = false);
+
+	UFUNCTION(BlueprintCallable)
+	static void ResetVideoTelemetry();
+
 public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
@@ -298,6 +657,19 @@ private:
 	UFUNCTION()
 	void OnMediaPlaybackEnd();
 
+	// 보조 플레이어 이벤트 핸들러
+	UFUNCTION()
+	void OnPreloadMediaOpened(FString OpenedUrl);
+
+	UFUNCTION()
+	void OnPreloadMediaOpenFailed(FString FailedUrl);
+
+	/**
+	 * 현재 역할(재생/사전 오픈)에 맞게 두 플레이어의 이벤트 바인딩
+	 */
+	void BindMediaPlayerEvents();
+	void UnbindMediaPlayerEvents(UMediaPlayer* InPlayer);
+
 	void OnWorldChanged(UWorld* OldWorld, UWorld* NewWorld);
 	virtual void OnFinishedAllVideos();
 
@@ -311,11 +683,65 @@ private:
 	 */
 	void PlayNextInSequence();
 
+	/**
+	 * 시퀀스 로직상 다음에 재생될 큐 인덱스 (없으면 INDEX_NONE)
+	 */
+	int32 FindNextVideoIndex(const int32 Index) const;
+
+	/**
+	 * 큐를 재생 그래프로 컴파일 및 검증
+	 * @return 재생 불가능한 항목이 있으면 false
+	 */
+	bool BuildPlaybackGraph();
+
+	/**
+	 * 현재 영상을 종료 처리하고 지정 인덱스로 전환 (INDEX_NONE이면 전체 종료)
+	 */
+	void AdvanceToIndex(const int32 InNextIndex);
+
+	/**
+	 * 요약 모드에서 건너뛴 (InFromIndex, InToIndex) 구간 영상의 종료 이벤트 일괄 발행
+	 * InToIndex가 INDEX_NONE이면 큐 끝까지
+	 */
+	void BroadcastSkippedVideos(const int32 InFromIndex, const int32 InToIndex);
+
+	/**
+	 * 다음 큐 영상을 보조 플레이어에 미리 열어둠 (더블 버퍼링)
+	 */
+	void PreloadNextVideo();
+	void CancelPreload();
+
+	/**
+	 * 요청된 영상이 사전 오픈된(또는 오픈 중인) 영상이면 두 플레이어를 교체
+	 * @param bOutOpened 오픈 완료 여부 (false면 OnMediaOpened 이벤트 대기)
+	 * @return 교체 여부 (false면 일반 오픈 경로 사용)
+	 */
+	bool SwapToPreloadedPlayer(const FVideoPlayHandler& InVideoPlayHandler, bool& bOutOpened);
+
 	/**
 	 * 미디어 소스 캐싱 및 조회
 	 */
 	TObjectPtr<UFileMediaSource> FindOrAddMediaSource(const FName& InGroupID, bool bIsLoop, const FString& InPath);
 
+	/**
+	 * 항목 수/용량 상한을 넘으면 가장 오래 조회되지 않은 소스부터 제거
+	 * 큐 전체가 변환된 뒤(PlayVideos) 1회 호출, 큐/재생 중인 소스는 제외
+	 */
+	void EvictMediaSources();
+
+	/**
+	 * 지정 인덱스 이후 재생 예정인 PrefetchVideoCount개 영상 파일 사전 읽기
+	 */
+	void PrefetchUpcomingVideos(const int32 InCurrentIndex);
+
+	/**
+	 * 첫 프레임 감지 (미디어 클럭이 진행하기 시작한 프레임)
+	 * 오픈 직후부터 감지될 때까지만 동작
+	 */
+	void StartFirstFrameProbe();
+	void StopFirstFrameProbe();
+	bool OnFirstFrameProbe(float DeltaTime);
+
 private: // Audio Focus
 	/**
 	 * 비디오 재생 시 배경 음악 볼륨 조절
@@ -0,0 +1,243 @@
+/**
+ * Video Player - Subtitle Benchmark
+ *
+ * 대용량 SRT 파싱 마이크로벤치마크
+ * - VideoPlayer.BenchSubtitle [큐 수] 콘솔 명령
+ * - 결과는 RewardBench와 같은 JSON 형식(reward-bench/1)으로 Saved/Profiling/SubtitleBench.json에 저장
+ *   → RewardBench --compare=<기준.json> <현재.json> 으로 회귀 비교 (allocs/op 증가도 회귀)
+ * - 측정 구간 동안 GMalloc을 계수 프록시로 교체해 측정 스레드의 할당 횟수/바이트 기록
+ * - 런타임 GMalloc 교체가 있으므로 Shipping 빌드에서는 제외
+ */
+
+#include "VideoPlayer.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformTLS.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace VideoBenchmark
+{
+	struct FResult
+	{
+		FString Name;
+		uint64 Iterations = 0;
+		double NsPerOp = 0.0;
+		double MinNsPerOp = 0.0;
+		double AllocsPerOp = 0.0;
+		double BytesPerOp = 0.0;
+	};
+
+	/**
+	 * 측정 스레드의 할당만 세는 GMalloc 프록시
+	 * - 헤더 없이 그대로 전달하므로 교체 전에 할당된 블록을 해제해도 안전
+	 * - 다른 스레드가 교체 직후에도 예전 포인터로 호출할 수 있으므로 해제하지 않음 (최초 1회 생성)
+	 */
+	class FCountingMalloc final : public FMalloc
+	{
+	public:
+		explicit FCountingMalloc(FMalloc* InInner) : Inner(InInner) {}
+
+		virtual void* Malloc(SIZE_T InCount, uint32 InAlignment) override
+		{
+			Track(InCount);
+			return Inner->Malloc(InCount, InAlignment);
+		}
+
+		virtual void* TryMalloc(SIZE_T InCount, uint32 InAlignment) override
+		{
+			Track(InCount);
+			return Inner->TryMalloc(InCount, InAlignment);
+		}
+
+		virtual void* Realloc(void* InOriginal, SIZE_T InCount, uint32 InAlignment) override
+		{
+			// 크기 변경도 새 블록 할당으로 계산 (0이면 해제)
+			if (InCount > 0)
+			{
+				Track(InCount);
+			}
+			return Inner->Realloc(InOriginal, InCount, InAlignment);
+		}
+
+		virtual void* TryRealloc(void* InOriginal, SIZE_T InCount, uint32 InAlignment) override
+		{
+			if (InCount > 0)
+			{
+				Track(InCount);
+			}
+			return Inner->TryRealloc(InOriginal, InCount, InAlignment);
+		}
+
+		virtual void Free(void* InOriginal) override { Inner->Free(InOriginal); }
+		virtual SIZE_T QuantizeSize(SIZE_T InCount, uint32 InAlignment) override { return Inner->QuantizeSize(InCount, InAlignment); }
+		virtual bool GetAllocationSize(void* InOriginal, SIZE_T& OutSize) override { return Inner->GetAllocationSize(InOriginal, OutSize); }
+		virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+		virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+		virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+
+		/**
+		 * 현재 스레드 할당 계수 시작 (GMalloc 교체)
+		 */
+		static FCountingMalloc& Begin()
+		{
+			static FCountingMalloc* Instance = new FCountingMalloc(GMalloc);
+
+			Instance->ThreadId = FPlatformTLS::GetCurrentThreadId();
+			Instance->Count = 0;
+			Instance->Bytes = 0;
+			GMalloc = Instance;
+			return *Instance;
+		}
+
+		void End()
+		{
+			GMalloc = Inner;
+		}
+
+		uint64 GetCount() const { return Count; }
+		uint64 GetBytes() const { return Bytes; }
+
+	private:
+		void Track(const SIZE_T InCount)
+		{
+			// 측정 스레드만 기록하므로 원자적 연산 불필요
+			if (FPlatformTLS::GetCurrentThreadId() == ThreadId)
+			{
+				++Count;
+				Bytes += InCount;
+			}
+		}
+
+		FMalloc* Inner;
+		uint32 ThreadId = 0;
+		uint64 Count = 0;
+		uint64 Bytes = 0;
+	};
+
+	/**
+	 * 측정 (샘플 1회가 MinSampleSeconds 이상이 되도록 반복 횟수 보정 후 5회 중앙값)
+	 */
+	template <typename FunctionType>
+	FResult Measure(const FString& InName, FunctionType&& InFunction)
+	{
+		static constexpr double MinSampleSeconds = 0.05;
+		static constexpr int32 SampleNum = 5;
+
+		auto RunSample = [&InFunction](const uint64 InIterations)
+		{
+			const double Begin = FPlatformTime::Seconds();
+			for (uint64 Index = 0; Index < InIterations; ++Index)
+			{
+				InFunction();
+			}
+			return FPlatformTime::Seconds() - Begin;
+		};
+
+		uint64 Iterations = 1;
+		for (double Elapsed = RunSample(Iterations); Elapsed < MinSampleSeconds; Elapsed = RunSample(Iterations))
+		{
+			Iterations *= Elapsed > 0.0 ? FMath::Clamp<uint64>(static_cast<uint64>(MinSampleSeconds / Elapsed * 1.2), 2, 10) : 10;
+		}
+
+		TArray<double> NsPerOp;
+		NsPerOp.Reserve(SampleNum);
+
+		FCountingMalloc& Counter = FCountingMalloc::Begin();
+		for (int32 Sample = 0; Sample < SampleNum; ++Sample)
+		{
+			NsPerOp.Emplace(RunSample(Iterations) * 1.0e9 / static_cast<double>(Iterations));
+		}
+		Counter.End();
+		NsPerOp.Sort();
+
+		FResult Result;
+		Result.Name = InName;
+		Result.Iterations = Iterations;
+		Result.NsPerOp = NsPerOp[SampleNum / 2];
+		Result.MinNsPerOp = NsPerOp[0];
+		Result.AllocsPerOp = static_cast<double>(Counter.GetCount()) / static_cast<double>(Iterations * SampleNum);
+		Result.BytesPerOp = static_cast<double>(Counter.GetBytes()) / static_cast<double>(Iterations * SampleNum);
+
+		// 로그 : [VideoBench] %s %.1f ns/op %.2f allocs/op %.1f B/op (min %.1f, %llu iters)
+		return Result;
+	}
+
+	/**
+	 * 합성 SRT (큐마다 2줄 텍스트, 3초 간격)
+	 */
+	FString MakeSrt(const int32 InCueNum)
+	{
+		FString Content;
+		Content.Reserve(InCueNum * 96);
+
+		for (int32 Index = 0; Index < InCueNum; ++Index)
+		{
+			const int32 StartMs = Index * 3000;
+			const int32 EndMs = StartMs + 2500;
+			Content += FString::Printf(TEXT("%d\n%02d:%02d:%02d,%03d --> %02d:%02d:%02d,%03d\nSubtitle line %d\n\n"),
+				Index + 1,
+				StartMs / 3600000, StartMs / 60000 % 60, StartMs / 1000 % 60, StartMs % 1000,
+				EndMs / 3600000, EndMs / 60000 % 60, EndMs / 1000 % 60, EndMs % 1000,
+				Index);
+		}
+		return Content;
+	}
+
+	void Run(const TArray<FString>& InArgs)
+	{
+		const int32 CueNum = InArgs.Num() > 0 ? FMath::Max(1, FCString::Atoi(*InArgs[0])) : 10000;
+
+		// Parse는 Content 기준 상대 경로를 받으므로 Saved 경로를 Content 기준으로 변환
+		const FString SrtPath = FPaths::ProjectSavedDir() / TEXT("Profiling/SubtitleBench.srt");
+		if (!FFileHelper::SaveStringToFile(MakeSrt(CueNum), *SrtPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+		{
+			// 로그 : [VideoBench] Failed to write %s
+			return;
+		}
+
+		FString RelativeSrtPath = FPaths::ConvertRelativePathToFull(SrtPath);
+		FPaths::MakePathRelativeTo(RelativeSrtPath, *FPaths::ConvertRelativePathToFull(FPaths::ProjectContentDir()));
+
+		USubtitle* Subtitle = NewObject<USubtitle>();
+
+		TArray<FResult> Results;
+		Results.Emplace(Measure(FString::Printf(TEXT("SubtitleParse/%d"), CueNum), [Subtitle, &RelativeSrtPath]()
+		{
+			Subtitle->Parse(RelativeSrtPath);
+		}));
+
+		const FString TimeString = TEXT("01:23:45,678");
+		Results.Emplace(Measure(TEXT("ParseTimeToTimespan"), [&TimeString]()
+		{
+			const FTimespan Timespan = USubtitle::ParseTimeToTimespan(TimeString);
+			(void)Timespan;
+		}));
+
+		Subtitle->MarkAsGarbage();
+
+		FString Json = TEXT("{\n\t\"schema\": \"reward-bench/1\",\n\t\"results\": [\n");
+		for (int32 Index = 0; Index < Results.Num(); ++Index)
+		{
+			const FResult& Result = Results[Index];
+			Json += FString::Printf(TEXT("\t\t{ \"name\": \"%s\", \"iterations\": %llu, \"ns_per_op\": %.1f, \"min_ns_per_op\": %.1f, \"allocs_per_op\": %.2f, \"bytes_per_op\": %.1f }%s\n"),
+				*Result.Name, Result.Iterations, Result.NsPerOp, Result.MinNsPerOp, Result.AllocsPerOp, Result.BytesPerOp, Index + 1 < Results.Num() ? TEXT(",") : TEXT(""));
+		}
+		Json += TEXT("\t]\n}\n");
+
+		const FString OutPath = FPaths::ProjectSavedDir() / TEXT("Profiling/SubtitleBench.json");
+		FFileHelper::SaveStringToFile(Json, *OutPath);
+		// 로그 : [VideoBench] Wrote %s
+	}
+
+	static FAutoConsoleCommand BenchSubtitleCommand(
+		TEXT("VideoPlayer.BenchSubtitle"),
+		TEXT("Benchmark SRT parsing on a generated file (arg: cue count, default 10000). Writes Saved/Profiling/SubtitleBench.json."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&Run));
+}
+
+#endif
@@ -11,9 +11,15 @@
 #include "Blueprint/UserWidget.h"
 #include "DataTable/VideoResourceData.h"
 #include "FileMediaSource.h"
+#include "HAL/FileManager.h"
 #include "MediaPlayer.h"
+#include "MediaSoundComponent.h"
+#include "MediaTexture.h"
 #include "Kismet/GameplayStatics.h"
 
+LLM_DEFINE_TAG(VideoPlayer);
+LLM_DEFINE_TAG(VideoSubtitle);
+
 void UVideoPlayer::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
@@ -21,14 +27,21 @@ void UVideoPlayer::Initialize(FSubsystemCollectionBase& Collection)
 	Instance = this;
 
 	// 미디어 플레이어 이벤트 바인딩
-	MediaPlayer->OnEndReached.AddUniqueDynamic(this, &UVideoPlayer::OnMediaPlaybackEnd);
-	MediaPlayer->OnMediaOpened.AddUniqueDynamic(this, &UVideoPlayer::OnMediaOpened);
-	MediaPlayer->OnMediaOpenFailed.AddUniqueDynamic(this, &UVideoPlayer::OnMediaOpenFailed);
+	BindMediaPlayerEvents();
 
 	MediaPlayer->SetLooping(false);
 	MediaPlayer->PlayOnOpen = false;
 
+	if (PreloadMediaPlayer)
+	{
+		PreloadMediaPlayer->SetLooping(false);
+		PreloadMediaPlayer->PlayOnOpen = false;
+	}
+
 	Subtitle = NewObject<USubtitle>();
+	Subtitle->SetUseScheduledTiming(bScheduledSubtitleTiming);
+
+	Prefetcher = MakeUnique<FVideoFilePrefetcher>();
 
 	if (UGameInstance* GameInstance = UGameInstance::Get())
 	{
@@ -38,6 +51,8 @@ void UVideoPlayer::Initialize(FSubsystemCollectionBase& Collection)
 
 void UVideoPlayer::Deinitialize()
 {
+	Prefetcher.Reset();
+
 	Super::Deinitialize();
 	Instance = nullptr;
 }
@@ -47,12 +62,17 @@ void UVideoPlayer::Deinitialize()
  *
  * 프로세스:
  * 1. 비디오 큐 초기화
- * 2. 첫 번째 비디오부터 재생 시작
- * 3. OnMediaPlaybackEnd에서 자동으로 다음 비디오 재생
+ * 2. 재생 그래프 컴파일 및 검증
+ * 3. 첫 번째 비디오부터 재생 시작
+ * 4. OnMediaPlaybackEnd에서 자동으로 다음 비디오 재생
  */
 bool UVideoPlayer::PlayVideos(const TArray<FVideoPlayHandler>& InVideoQueue, const EUIName InVideoPlayer)
 {
+	Instance->CancelPreload();
+	Instance->Prefetcher->Cancel();
+	Instance->Telemetry.OnSequenceEnd();
 	Instance->VideoQueue.Reset();
+	Instance->bSummaryMode = false;
 	if (InVideoQueue.Num() == 0)
 	{
 		return false;
@@ -60,6 +80,17 @@ bool UVideoPlayer::PlayVideos(const TArray<FVideoPlayHandler>& InVideoQueue, con
 
 	Instance->VideoPlayer = InVideoPlayer;
 	Instance->VideoQueue = InVideoQueue;
+
+	if (!Instance->BuildPlaybackGraph())
+	{
+		Instance->VideoQueue.Reset();
+		Instance->PlaybackGraph.Reset();
+		return false;
+	}
+
+	// 큐 전체 변환이 끝난 뒤 캐시 정리 (같은 시퀀스의 소스는 제거 대상 아님)
+	Instance->EvictMediaSources();
+
 	Instance->CurrentVideoIndex = 0;
 	Instance->MaxVideoIndex = InVideoQueue.Num() - 1;
 
@@ -68,11 +99,18 @@ bool UVideoPlayer::PlayVideos(const TArray<FVideoPlayHandler>& InVideoQueue, con
 
 bool UVideoPlayer::PlayVideoAtIndex(const int32 Index)
 {
+	LLM_SCOPE_BYTAG(VideoPlayer);
+
 	if (!VideoQueue.IsValidIndex(Index))
 	{
 		return false;
 	}
 
+	// 이후 재생될 영상 파일 미리 읽기
+	PrefetchUpcomingVideos(Index);
+
+	Telemetry.OnNextVideoRequested();
+
 	return PlayVideo(VideoQueue[Index], Instance->VideoPlayer);
 }
 
@@ -111,14 +149,21 @@ bool UVideoPlayer::PlayVideo(const FVideoPlayHandler& InVideoPlayHandler, const
 
 	// 로그 : [VideoPlayer] PlayVideo MediaSource[%s], Loop=%d"
 
+	Instance->Telemetry.OnPlayRequested(InVideoPlayHandler.GroupID);
+
+	// 사전 오픈된 영상이면 플레이어만 교체 (오픈/버퍼링 생략)
+	bool bPreloadOpened = false;
+	const bool bPreloaded = Instance->SwapToPreloadedPlayer(Instance->MediaHandler, bPreloadOpened);
+
 	// 미디어 소스 열기
-	const bool bSucceed = Instance->MediaPlayer->OpenSource(Instance->MediaHandler.MediaSource);
+	const bool bSucceed = bPreloaded || Instance->MediaPlayer->OpenSource(Instance->MediaHandler.MediaSource);
 	Instance->bOpenVideo = true;
 	Instance->MediaPlayer->SetLooping(InVideoPlayHandler.bLoop);
 
 	if (!bSucceed)
 	{
 		// 로그 : [VideoPlayer] OpenSource Failed [%s]
+		Instance->Telemetry.OnOpenFailed();
 		Instance->bOpenVideo = false;
 		UUIBlueprintLibrary::CloseUIByName(Instance->VideoPlayer);
 		return false;
@@ -127,9 +172,9 @@ bool UVideoPlayer::PlayVideo(const FVideoPlayHandler& InVideoPlayHandler, const
 	Instance->LastPlayStartTime = FPlatformTime::Seconds();
 
 	// 자막 파싱 및 활성화
-	if (!VideoPlayHandler.SubtitlePath.IsEmpty())
+	if (!InVideoPlayHandler.SubtitlePath.IsEmpty())
 	{
-		Instance->Subtitle->Parse(VideoPlayHandler.SubtitlePath);
+		Instance->Subtitle->Parse(InVideoPlayHandler.SubtitlePath);
 		Instance->Subtitle->Play(Instance->MediaPlayer);
 		// 로그 : [VideoPlayer] SubtitlePath = [%s]
 	}
@@ -147,6 +192,12 @@ bool UVideoPlayer::PlayVideo(const FVideoPlayHandler& InVideoPlayHandler, const
 
 	UBlueprintLibrary::SetUsingIdleAnimation(Instance->GetWorld(), true);
 
+	// 이미 오픈이 끝난 플레이어로 교체된 경우 OnMediaOpened 이벤트가 다시 오지 않음
+	if (bPreloadOpened)
+	{
+		Instance->OnMediaOpened(Instance->MediaPlayer->GetUrl());
+	}
+
 	return bSucceed;
 }
 
@@ -197,6 +248,9 @@ void UVideoPlayer::OnMediaOpened(FString OpenedUrl)
 {
 	// 로그 : [VideoPlayer] OnMediaOpened URL[%s]"
 
+	Telemetry.OnOpened();
+	StartFirstFrameProbe();
+
 	const FTimespan Duration = Instance->MediaPlayer->GetDuration();
 	// 로그 : [VideoPlayer] Media Duration = %f sec
 
@@ -218,12 +272,18 @@ void UVideoPlayer::OnMediaOpened(FString OpenedUrl)
 		Instance->bOpenVideo = false;
         VideoPlayerUI->OnMediaOpened();
     }
+
+	// 재생 중에 다음 영상 미리 열기
+	PreloadNextVideo();
 }
 
 void UVideoPlayer::OnMediaOpenFailed(FString FailedUrl)
 {
 	// 로그 : [VideoPlayer] OnMediaOpenFailed URL[%s]
 
+	StopFirstFrameProbe();
+	Telemetry.OnOpenFailed();
+
 	ApplyVideoAudioFocus(false);
 	UUIBlueprintLibrary::CloseUIByName(Instance->VideoPlayer);
 }
@@ -256,12 +316,14 @@ void UVideoPlayer::OnMediaPlaybackEnd()
     if (Elapsed < 0.5f)
     {
         // 로그 : [VideoPlayer] Ignored false End (Elapsed=%.3f, Current=%.3f, Duration=%.3f)
+        Telemetry.OnFalseEnd();
         return;
     }
 
     if (Duration.GetTotalSeconds() > 1.0 && Current.GetTotalSeconds() < Duration.GetTotalSeconds() * 0.95)
     {
         // 로그 : [VideoPlayer] Ignored false End event. Current=%f / Duration=%f
+        Telemetry.OnEarlyEnd();
     }
 
     // 로그 : [VideoPlayer] OnMediaPlaybackEnd
@@ -281,6 +343,8 @@ void UVideoPlayer::OnMediaPlaybackEnd()
         return;
     }
 
+    Telemetry.OnPlaybackEnd();
+
     OnSingleVideoEnd.Broadcast(CurrentVideoIndex);
     PlayNextInSequence();
 }
@@ -297,43 +361,346 @@ void UVideoPlayer::PlayNextInSequence()
 {
 	// 로그 : [VideoPlayer] PlayNextInSequence
 
-	if (!VideoQueue.IsValidIndex(CurrentVideoIndex))
+	const int32 NextIndex = FindNextVideoIndex(CurrentVideoIndex);
+	BroadcastSkippedVideos(CurrentVideoIndex, NextIndex);
+
+	if (!VideoQueue.IsValidIndex(NextIndex))
     {
         OnFinishedAllVideos();
         return;
     }
 
-    const FVideoPlayHandler& CurrentHandler = VideoQueue[CurrentVideoIndex];
+	CurrentVideoIndex = NextIndex;
+	PlayVideoAtIndex(CurrentVideoIndex);
+}
 
-	// 현재 비디오가 Prologue인 경우, 같은 그룹의 Loop 비디오 찾기
-    if (!CurrentHandler.bLoop)
-    {
-        const int32 NextIndex = CurrentVideoIndex + 1;
-        if (VideoQueue.IsValidIndex(NextIndex))
-        {
-            const FVideoPlayHandler& NextHandler = VideoQueue[NextIndex];
-            if (NextHandler.GroupID == CurrentHandler.GroupID && NextHandler.bLoop)
-            {
-                CurrentVideoIndex = NextIndex;
-                PlayVideoAtIndex(CurrentVideoIndex);
-                return;
-            }
-        }
-    }
+int32 UVideoPlayer::FindNextVideoIndex(const int32 Index) const
+{
+	if (!PlaybackGraph.IsValidIndex(Index))
+	{
+		return INDEX_NONE;
+	}
 
-	// 다음 비루프 비디오 찾기
-    for (int32 i = CurrentVideoIndex + 1; i < VideoQueue.Num(); ++i)
-    {
-        const FVideoPlayHandler& NextHandler = VideoQueue[i];
-        if (!NextHandler.bLoop)
-        {
-            CurrentVideoIndex = i;
-            PlayVideoAtIndex(CurrentVideoIndex);
-            return;
-        }
-    }
+	return bSummaryMode ? PlaybackGraph[Index].NextForcedIndex : PlaybackGraph[Index].NextIndex;
+}
+
+/**
+ * 재생 그래프 컴파일
+ *
+ * 역순으로 한 번 순회하며 항목별 전환 대상 계산 (O(n)):
+ * - LoopPartnerIndex : Prologue 바로 뒤의 같은 그룹 Loop
+ * - SkipTargetIndex  : 이후 첫 번째 비루프 항목
+ * - NextIndex        : Loop 짝이 있으면 Loop, 없으면 SkipTarget
+ * - NextForcedIndex  : 이후 첫 번째 필수 재생 비루프 항목 (요약 모드)
+ *
+ * 검증:
+ * - 미디어 소스가 없는 항목이 있으면 큐 거부
+ * - Prologue 없이 중간에 놓인 Loop는 도달 불가 (로그만 남김)
+ */
+bool UVideoPlayer::BuildPlaybackGraph()
+{
+	PlaybackGraph.Reset();
+	PlaybackGraph.SetNum(VideoQueue.Num());
+
+	int32 NextNonLoopIndex = INDEX_NONE;
+	int32 NextForcedIndex = INDEX_NONE;
+	for (int32 Index = VideoQueue.Num() - 1; Index >= 0; --Index)
+	{
+		const FVideoPlayHandler& Handler = VideoQueue[Index];
+		if (!IsValid(Handler.MediaSource))
+		{
+			// 로그 : [VideoPlayer] Invalid MediaSource at Index[%d]
+			ensure(false);
+			return false;
+		}
+
+		FVideoPlaybackNode& Node = PlaybackGraph[Index];
+		Node.SkipTargetIndex = NextNonLoopIndex;
+		Node.NextForcedIndex = NextForcedIndex;
 
-    OnFinishedAllVideos();
+		if (!Handler.bLoop)
+		{
+			const int32 PartnerIndex = Index + 1;
+			if (VideoQueue.IsValidIndex(PartnerIndex) && VideoQueue[PartnerIndex].bLoop && VideoQueue[PartnerIndex].GroupID == Handler.GroupID)
+			{
+				Node.LoopPartnerIndex = PartnerIndex;
+			}
+			NextNonLoopIndex = Index;
+
+			if (Handler.bForcePlay)
+			{
+				NextForcedIndex = Index;
+			}
+		}
+		else if (Index > 0 && (VideoQueue[Index - 1].bLoop || VideoQueue[Index - 1].GroupID != Handler.GroupID))
+		{
+			// 로그 : [VideoPlayer] Unreachable loop video at Index[%d] (GroupID=%s)
+		}
+
+		Node.NextIndex = Node.LoopPartnerIndex != INDEX_NONE ? Node.LoopPartnerIndex : Node.SkipTargetIndex;
+	}
+
+	return true;
+}
+
+/**
+ * 수동 전환 (NextVideo / SkipToNextVideo)
+ *
+ * - 현재 영상 재생 구간 기록 및 종료 이벤트 발행
+ * - 대상 인덱스가 없으면 전체 종료
+ */
+void UVideoPlayer::AdvanceToIndex(const int32 InNextIndex)
+{
+	if (Subtitle)
+	{
+		Subtitle->Stop();
+	}
+
+	Telemetry.OnPlaybackEnd();
+
+	OnSingleVideoEnd.Broadcast(CurrentVideoIndex);
+	BroadcastSkippedVideos(CurrentVideoIndex, InNextIndex);
+
+	if (!VideoQueue.IsValidIndex(InNextIndex))
+	{
+		OnFinishedAllVideos();
+		return;
+	}
+
+	// 재생 중인 영상 정지 (사전 오픈된 보조 플레이어는 유지)
+	MediaPlayer->Close();
+
+	CurrentVideoIndex = InNextIndex;
+	PlayVideoAtIndex(CurrentVideoIndex);
+}
+
+/**
+ * 다음 영상으로 전환
+ * @param bSkipLoop true면 현재 Prologue의 Loop도 건너뜀
+ */
+void UVideoPlayer::NextVideo(const bool bSkipLoop)
+{
+	if (!Instance || !Instance->PlaybackGraph.IsValidIndex(Instance->CurrentVideoIndex))
+	{
+		return;
+	}
+
+	const FVideoPlaybackNode& Node = Instance->PlaybackGraph[Instance->CurrentVideoIndex];
+	Instance->AdvanceToIndex(bSkipLoop ? Node.SkipTargetIndex : Node.NextIndex);
+}
+
+/**
+ * 스킵 (현재 영상과 그 Loop를 건너뛰고 다음 비루프 영상으로)
+ */
+void UVideoPlayer::SkipToNextVideo()
+{
+	if (!Instance || !Instance->PlaybackGraph.IsValidIndex(Instance->CurrentVideoIndex))
+	{
+		return;
+	}
+
+	if (!Instance->VideoQueue[Instance->CurrentVideoIndex].bUseSkip)
+	{
+		return;
+	}
+
+	// 건너뛴 영상 기준 사전 읽기 취소 (전환 후 새 위치 기준으로 재요청)
+	Instance->Prefetcher->Cancel();
+	Instance->AdvanceToIndex(Instance->PlaybackGraph[Instance->CurrentVideoIndex].SkipTargetIndex);
+}
+
+/**
+ * 요약 모드 (스킵 시 결과 화면까지 한 번에 전환)
+ *
+ * 로직:
+ * 1. 이후 전환은 재생 그래프의 NextForcedIndex를 따름
+ * 2. 현재 영상이 필수 재생이면 끝까지 재생 후 전환
+ * 3. 그 외에는 즉시 다음 필수 재생 영상으로 이동
+ * 4. 건너뛴 영상은 미디어를 열지 않고 OnSingleVideoEnd만 일괄 발행
+ *    (남은 필수 영상이 없으면 OnAllVideosEnd까지 한 번에 발행)
+ */
+void UVideoPlayer::SkipToSummary()
+{
+	if (!Instance || !Instance->PlaybackGraph.IsValidIndex(Instance->CurrentVideoIndex) || Instance->bSummaryMode)
+	{
+		return;
+	}
+
+	if (!Instance->VideoQueue[Instance->CurrentVideoIndex].bUseSkip)
+	{
+		return;
+	}
+
+	// 로그 : [VideoPlayer] SkipToSummary from Index[%d]
+	Instance->bSummaryMode = true;
+
+	// 사전 오픈/읽기 대상이 요약 경로와 다르므로 재요청
+	Instance->CancelPreload();
+	Instance->Prefetcher->Cancel();
+
+	const FVideoPlayHandler& CurrentHandler = Instance->VideoQueue[Instance->CurrentVideoIndex];
+	if (CurrentHandler.bForcePlay && !CurrentHandler.bLoop)
+	{
+		Instance->PreloadNextVideo();
+		Instance->PrefetchUpcomingVideos(Instance->CurrentVideoIndex);
+		return;
+	}
+
+	Instance->AdvanceToIndex(Instance->FindNextVideoIndex(Instance->CurrentVideoIndex));
+}
+
+void UVideoPlayer::BroadcastSkippedVideos(const int32 InFromIndex, const int32 InToIndex)
+{
+	if (!bSummaryMode)
+	{
+		return;
+	}
+
+	// 일반 재생 흐름과 동일하게 비루프 영상만 종료 이벤트 발행
+	const int32 EndIndex = VideoQueue.IsValidIndex(InToIndex) ? InToIndex : VideoQueue.Num();
+	for (int32 Index = InFromIndex + 1; Index < EndIndex; ++Index)
+	{
+		if (!VideoQueue[Index].bLoop)
+		{
+			OnSingleVideoEnd.Broadcast(Index);
+		}
+	}
+}
+
+/**
+ * 더블 버퍼링 - 다음 영상 사전 오픈
+ *
+ * 현재 영상이 재생되는 동안 보조 플레이어에서 다음 큐 영상을
+ * 열어두어 전환 시 오픈 대기 제거 (Prologue → Loop, 결과 → 결과 전환)
+ * - 오픈만 수행 (PlayOnOpen false), 첫 프레임 디코딩은 교체 후 Play 시점
+ * - 교체 시 출력 텍스처를 새 플레이어로 옮겨야 하므로 MediaTexture 미설정 시 비활성
+ */
+void UVideoPlayer::PreloadNextVideo()
+{
+	if (!PreloadMediaPlayer || !MediaTexture)
+	{
+		return;
+	}
+
+	const int32 NextIndex = FindNextVideoIndex(CurrentVideoIndex);
+	if (NextIndex == PreloadVideoIndex)
+	{
+		return;
+	}
+
+	CancelPreload();
+
+	if (!VideoQueue.IsValidIndex(NextIndex) || !IsValid(VideoQueue[NextIndex].MediaSource))
+	{
+		return;
+	}
+
+	const FVideoPlayHandler& NextHandler = VideoQueue[NextIndex];
+	PreloadMediaPlayer->SetLooping(NextHandler.bLoop);
+	if (PreloadMediaPlayer->OpenSource(NextHandler.MediaSource))
+	{
+		// 로그 : [VideoPlayer] Preload Index[%d]
+		PreloadVideoIndex = NextIndex;
+	}
+}
+
+void UVideoPlayer::CancelPreload()
+{
+	if (PreloadVideoIndex != INDEX_NONE && PreloadMediaPlayer)
+	{
+		PreloadMediaPlayer->Close();
+	}
+
+	PreloadVideoIndex = INDEX_NONE;
+	bPreloadReady = false;
+}
+
+/**
+ * 사전 오픈된 플레이어로 교체
+ *
+ * - 이전 재생 플레이어는 닫고 보조 플레이어로 사용
+ * - 이벤트 바인딩, 미디어 텍스처, 사운드 컴포넌트 대상 교체
+ * - 아직 오픈 중이면 교체된 플레이어의 OnMediaOpened 이벤트로 이어서 진행
+ */
+bool UVideoPlayer::SwapToPreloadedPlayer(const FVideoPlayHandler& InVideoPlayHandler, bool& bOutOpened)
+{
+	bOutOpened = false;
+
+	const bool bMatched = PreloadMediaPlayer
+		&& VideoQueue.IsValidIndex(PreloadVideoIndex)
+		&& VideoQueue[PreloadVideoIndex].MediaSource == InVideoPlayHandler.MediaSource;
+
+	if (!bMatched)
+	{
+		CancelPreload();
+		return false;
+	}
+
+	bOutOpened = bPreloadReady;
+	PreloadVideoIndex = INDEX_NONE;
+	bPreloadReady = false;
+
+	UnbindMediaPlayerEvents(MediaPlayer);
+	UnbindMediaPlayerEvents(PreloadMediaPlayer);
+	MediaPlayer->Close();
+
+	Swap(MediaPlayer, PreloadMediaPlayer);
+	BindMediaPlayerEvents();
+
+	if (MediaTexture)
+	{
+		MediaTexture->SetMediaPlayer(MediaPlayer);
+	}
+
+	if (MediaSoundProvider.IsValid())
+	{
+		if (UMediaSoundComponent* SoundComponent = MediaSoundProvider->FindComponentByClass<UMediaSoundComponent>())
+		{
+			SoundComponent->SetMediaPlayer(MediaPlayer);
+		}
+	}
+
+	// 로그 : [VideoPlayer] Swapped to preloaded player (Opened=%d)
+	return true;
+}
+
+void UVideoPlayer::OnPreloadMediaOpened(FString OpenedUrl)
+{
+	// 로그 : [VideoPlayer] OnPreloadMediaOpened URL[%s]
+	bPreloadReady = PreloadVideoIndex != INDEX_NONE;
+}
+
+void UVideoPlayer::OnPreloadMediaOpenFailed(FString FailedUrl)
+{
+	// 로그 : [VideoPlayer] OnPreloadMediaOpenFailed URL[%s]
+	// 전환 시 일반 오픈 경로로 재시도
+	PreloadVideoIndex = INDEX_NONE;
+	bPreloadReady = false;
+}
+
+void UVideoPlayer::BindMediaPlayerEvents()
+{
+	MediaPlayer->OnEndReached.AddUniqueDynamic(this, &UVideoPlayer::OnMediaPlaybackEnd);
+	MediaPlayer->OnMediaOpened.AddUniqueDynamic(this, &UVideoPlayer::OnMediaOpened);
+	MediaPlayer->OnMediaOpenFailed.AddUniqueDynamic(this, &UVideoPlayer::OnMediaOpenFailed);
+
+	if (PreloadMediaPlayer)
+	{
+		PreloadMediaPlayer->OnMediaOpened.AddUniqueDynamic(this, &UVideoPlayer::OnPreloadMediaOpened);
+		PreloadMediaPlayer->OnMediaOpenFailed.AddUniqueDynamic(this, &UVideoPlayer::OnPreloadMediaOpenFailed);
+	}
+}
+
+void UVideoPlayer::UnbindMediaPlayerEvents(UMediaPlayer* InPlayer)
+{
+	if (!InPlayer)
+	{
+		return;
+	}
+
+	InPlayer->OnEndReached.RemoveAll(this);
+	InPlayer->OnMediaOpened.RemoveAll(this);
+	InPlayer->OnMediaOpenFailed.RemoveAll(this);
 }
 
 /**
@@ -356,8 +723,14 @@ void UVideoPlayer::OnFinishedAllVideos()
 
 	ApplyVideoAudioFocus(false);
 
+	CancelPreload();
+	Prefetcher->Cancel();
+	StopFirstFrameProbe();
+	Telemetry.OnSequenceEnd();
 	MediaPlayer->Close();
 	VideoQueue.Reset();
+	PlaybackGraph.Reset();
+	bSummaryMode = false;
 
 	OnAllVideosEnd.Broadcast();
 	UUIBlueprintLibrary::CloseUIByName(Instance->VideoPlayer);
@@ -377,24 +750,118 @@ void UVideoPlayer::OnFinishedAllVideos()
 }
 
 /**
- * 미디어 소스 캐싱 시스템
+ * 미디어 소스 캐싱 시스템 (LRU)
  *
  * 이점:
  * - 동일한 비디오 재생 시 파일 재로드 방지
- * - 메모리 효율성
+ * - 항목 수/파일 크기 상한으로 긴 세션에서도 캐시 크기 유지
+ * - 구조체 키 사용 (조회 시 문자열 생성 없음)
  */
 TObjectPtr<UFileMediaSource> UVideoPlayer::FindOrAddMediaSource(const FName& GroupID, bool bIsLoop, const FString& Path)
 {
-	const FString KeyString = FString::Printf(TEXT("%s_%s"), *GroupID.ToString(), bIsLoop ? TEXT("Loop") : TEXT("Prologue"));
-	const FName KeyName(*KeyString);
+	const FVideoMediaSourceKey Key(GroupID, bIsLoop);
+
+	FCachedMediaSourceEntry& Entry = CachedMediaSource.FindOrAdd(Key);
+	Entry.LastAccess = ++MediaSourceAccessSerial;
 
-	TObjectPtr<UFileMediaSource>& MediaSource = CachedMediaSource.FindOrAdd(KeyName);
-	if (!MediaSource)
+	if (Entry.MediaSource)
 	{
-		MediaSource = NewObject<UFileMediaSource>(this);
-		MediaSource->SetFilePath(Path);
+		++MediaSourceCacheStats.Hits;
+		return Entry.MediaSource;
 	}
-	return MediaSource;
+
+	++MediaSourceCacheStats.Misses;
+
+	// 파일 크기는 제거 판정 시점에 확인 (미스마다 동기 stat 없음)
+	Entry.MediaSource = NewObject<UFileMediaSource>(this);
+	Entry.MediaSource->SetFilePath(Path);
+	Entry.FileSize = INDEX_NONE;
+	return Entry.MediaSource;
+}
+
+void UVideoPlayer::EvictMediaSources()
+{
+	// 크기를 아직 모르는 항목 : 사전 읽기에서 확인한 크기 우선, 없을 때만 stat (항목당 1회)
+	if (MaxCachedMediaSourceBytes > 0)
+	{
+		for (TPair<FVideoMediaSourceKey, FCachedMediaSourceEntry>& Pair : CachedMediaSource)
+		{
+			FCachedMediaSourceEntry& Entry = Pair.Value;
+			if (Entry.FileSize != INDEX_NONE || !Entry.MediaSource)
+			{
+				continue;
+			}
+
+			const FString FullPath = Entry.MediaSource->GetFullPath();
+			const int64 PrefetchedSize = Prefetcher ? Prefetcher->FindFileSize(FullPath) : INDEX_NONE;
+			Entry.FileSize = FMath::Max<int64>(PrefetchedSize != INDEX_NONE ? PrefetchedSize : IFileManager::Get().FileSize(*FullPath), 0);
+			MediaSourceCacheStats.Bytes += Entry.FileSize;
+		}
+	}
+
+	auto IsOverBudget = [this]()
+	{
+		return CachedMediaSource.Num() > MaxCachedMediaSources
+			|| (MaxCachedMediaSourceBytes > 0 && MediaSourceCacheStats.Bytes > MaxCachedMediaSourceBytes);
+	};
+
+	if (!IsOverBudget())
+	{
+		return;
+	}
+
+	// 사용 중인 소스 수집 (큐, 현재 재생)
+	TSet<const UMediaSource*> InUseSources;
+	InUseSources.Reserve(VideoQueue.Num() + 1);
+	for (const FVideoPlayHandler& Handler : VideoQueue)
+	{
+		InUseSources.Add(Handler.MediaSource);
+	}
+	InUseSources.Add(MediaHandler.MediaSource);
+
+	while (IsOverBudget())
+	{
+		const FVideoMediaSourceKey* OldestKey{ nullptr };
+		uint64 OldestAccess = MAX_uint64;
+
+		for (const TPair<FVideoMediaSourceKey, FCachedMediaSourceEntry>& Pair : CachedMediaSource)
+		{
+			if (InUseSources.Contains(Pair.Value.MediaSource))
+			{
+				continue;
+			}
+
+			if (Pair.Value.LastAccess < OldestAccess)
+			{
+				OldestAccess = Pair.Value.LastAccess;
+				OldestKey = &Pair.Key;
+			}
+		}
+
+		// 모두 사용 중이면 상한을 잠시 초과 허용
+		if (!OldestKey)
+		{
+			break;
+		}
+
+		// 로그 : [VideoPlayer] Evict MediaSource [%s_%d]
+		const FVideoMediaSourceKey EvictKey = *OldestKey;
+		MediaSourceCacheStats.Bytes -= FMath::Max<int64>(CachedMediaSource.FindChecked(EvictKey).FileSize, 0);
+		CachedMediaSource.Remove(EvictKey);
+		++MediaSourceCacheStats.Evictions;
+	}
+}
+
+FVideoMediaSourceCacheStats UVideoPlayer::GetMediaSourceCacheStats()
+{
+	if (!Instance)
+	{
+		return {};
+	}
+
+	FVideoMediaSourceCacheStats Stats = Instance->MediaSourceCacheStats;
+	Stats.Num = Instance->CachedMediaSource.Num();
+	return Stats;
 }
 
 /**
@@ -0,0 +1,189 @@
+/**
+ * Video Player - Prefetch Implementation
+ *
+ * 큐에 예정된 영상 파일을 미리 OS 페이지 캐시에 적재하여
+ * HDD/저속 eMMC 환경에서 콜드 오픈 지연(첫 프레임까지의 시간) 단축
+ */
+
+#include "VideoPlayer.h"
+#include "FileMediaSource.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+
+#if PLATFORM_UNIX || PLATFORM_ANDROID
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+FVideoFilePrefetcher::~FVideoFilePrefetcher()
+{
+	Cancel();
+
+	if (Task.IsValid())
+	{
+		Task.Wait();
+	}
+}
+
+/**
+ * 사전 읽기 요청
+ *
+ * 로직:
+ * 1. 이미 요청한 파일 제외
+ * 2. 바이트 예산 내에서 파일별 읽을 크기 결정
+ * 3. 이전 요청 뒤에 이어서 백그라운드 태스크로 순차 실행
+ */
+void FVideoFilePrefetcher::Prefetch(const TArray<FString>& InFilePaths, const int64 InByteBudget)
+{
+	TArray<TPair<FString, int64>> Files;
+	Files.Reserve(InFilePaths.Num());
+
+	int64 RemainingBudget = InByteBudget;
+	for (const FString& FilePath : InFilePaths)
+	{
+		if (RemainingBudget <= 0)
+		{
+			break;
+		}
+
+		bool bAlreadyRequested = false;
+		RequestedPaths.Add(FilePath, &bAlreadyRequested);
+		if (bAlreadyRequested)
+		{
+			continue;
+		}
+
+		int64& FileSize = FileSizes.FindOrAdd(FilePath, INDEX_NONE);
+		if (FileSize == INDEX_NONE)
+		{
+			FileSize = IFileManager::Get().FileSize(*FilePath);
+		}
+		if (FileSize <= 0)
+		{
+			continue;
+		}
+
+		const int64 Bytes = FMath::Min(FileSize, RemainingBudget);
+		Files.Emplace(FilePath, Bytes);
+		RemainingBudget -= Bytes;
+	}
+
+	if (Files.IsEmpty())
+	{
+		return;
+	}
+
+	if (!CancelFlag)
+	{
+		CancelFlag = MakeShared<std::atomic<bool>, ESPMode::ThreadSafe>(false);
+	}
+
+	auto PrefetchFiles = [Files = MoveTemp(Files), Flag = CancelFlag]()
+	{
+		for (const TPair<FString, int64>& File : Files)
+		{
+			if (Flag->load(std::memory_order_relaxed))
+			{
+				return;
+			}
+
+			// 로그 : [VideoPrefetch] %s (%lld bytes)
+			PrefetchFile(File.Key, File.Value, *Flag);
+		}
+	};
+
+	Task = Task.IsValid()
+		? UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(PrefetchFiles), UE::Tasks::Prerequisites(Task), UE::Tasks::ETaskPriority::BackgroundLow)
+		: UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(PrefetchFiles), UE::Tasks::ETaskPriority::BackgroundLow);
+}
+
+void FVideoFilePrefetcher::Cancel()
+{
+	// 실행 중인 태스크는 플래그를 보고 다음 청크/파일에서 종료
+	if (CancelFlag)
+	{
+		CancelFlag->store(true, std::memory_order_relaxed);
+		CancelFlag.Reset();
+	}
+
+	RequestedPaths.Reset();
+}
+
+int64 FVideoFilePrefetcher::FindFileSize(const FString& InPath) const
+{
+	const int64* FileSize = FileSizes.Find(InPath);
+	return FileSize ? *FileSize : INDEX_NONE;
+}
+
+/**
+ * 파일 하나를 OS 페이지 캐시에 적재
+ */
+void FVideoFilePrefetcher::PrefetchFile(const FString& InPath, const int64 InBytes, const std::atomic<bool>& bCancelled)
+{
+#if PLATFORM_UNIX || PLATFORM_ANDROID
+	// 커널 비동기 readahead 요청 (즉시 반환)
+	const FString FullPath = IFileManager::Get().ConvertToAbsolutePathForExternalAppForRead(*InPath);
+	const int32 FileDescriptor = open(TCHAR_TO_UTF8(*FullPath), O_RDONLY | O_CLOEXEC);
+	if (FileDescriptor >= 0)
+	{
+		const int32 Result = posix_fadvise(FileDescriptor, 0, InBytes, POSIX_FADV_WILLNEED);
+		close(FileDescriptor);
+
+		if (Result == 0)
+		{
+			return;
+		}
+	}
+#endif
+
+	// 청크 단위 읽기로 OS 캐시 적재 (패키지 내부 파일 등 fadvise 불가 시 포함)
+	TUniquePtr<IFileHandle> FileHandle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*InPath));
+	if (!FileHandle)
+	{
+		return;
+	}
+
+	static constexpr int64 ChunkSize = 1024 * 1024;
+	TArray<uint8> Buffer;
+	Buffer.SetNumUninitialized(ChunkSize);
+
+	for (int64 Offset = 0; Offset < InBytes; Offset += ChunkSize)
+	{
+		if (bCancelled.load(std::memory_order_relaxed))
+		{
+			return;
+		}
+
+		if (!FileHandle->Read(Buffer.GetData(), FMath::Min(ChunkSize, InBytes - Offset)))
+		{
+			return;
+		}
+	}
+}
+
+/**
+ * 다음 재생 예정 영상 파일 사전 읽기
+ *
+ * 재생 그래프를 따라 현재 영상 이후 PrefetchVideoCount개 파일을 재생 순서대로 요청
+ * (요약 모드면 필수 재생 영상만, Prologue/Loop가 같은 파일이면 중복 제외)
+ */
+void UVideoPlayer::PrefetchUpcomingVideos(const int32 InCurrentIndex)
+{
+	if (!Prefetcher || PrefetchVideoCount <= 0 || PrefetchByteBudget <= 0)
+	{
+		return;
+	}
+
+	TArray<FString> FilePaths;
+	FilePaths.Reserve(PrefetchVideoCount);
+
+	for (int32 Index = FindNextVideoIndex(InCurrentIndex); VideoQueue.IsValidIndex(Index) && FilePaths.Num() < PrefetchVideoCount; Index = FindNextVideoIndex(Index))
+	{
+		if (const UFileMediaSource* FileSource = Cast<UFileMediaSource>(VideoQueue[Index].MediaSource))
+		{
+			FilePaths.AddUnique(FileSource->GetFullPath());
+		}
+	}
+
+	Prefetcher->Prefetch(FilePaths, PrefetchByteBudget);
+}
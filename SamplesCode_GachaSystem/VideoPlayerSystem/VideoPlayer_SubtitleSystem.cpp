@@ -37,6 +37,9 @@ USubtitle::USubtitle(FObjectInitializer& Initializer) : Super(Initializer)
  */
 void USubtitle::Parse(const FString& InFilePath)
 {
+	// 줄 단위 FString 할당 포함
+	LLM_SCOPE_BYTAG(VideoSubtitle);
+
 	SubtitleCue.Empty();
 
 	const FString FullPath = FPaths::ProjectContentDir() + InFilePath;
@@ -103,12 +106,23 @@ FTimespan USubtitle::ParseTimeToTimespan(const FString& InTimeString)
 
 void USubtitle::Play(UMediaPlayer* Player)
 {
+	ClearSchedule();
+	UnbindMediaClockEvents();
+
 	VideoPlayer = Player;
 	CurrentIndex = 0;
+	StalledWakeCount = 0;
+	LastWakeTime = FTimespan(0);
+
+	BindMediaClockEvents(Player);
+	ScheduleNextBoundary();
 }
 
 void USubtitle::Stop()
 {
+	ClearSchedule();
+	UnbindMediaClockEvents();
+
 	if (bIsShowingNarration)
     {
         UDialogUI::CloseDialogWidget(GetFName());
@@ -117,26 +131,24 @@ void USubtitle::Stop()
     bIsShowingNarration = false;
     CurrentIndex = 0;
     VideoPlayer = nullptr;
+	TimingMode = ESubtitleTimingMode::Scheduled;
 	SubtitleCue.Empty();
 }
 
 /**
- * 매 프레임 자막 동기화
+ * 자막 표시/숨김 처리
  *
  * 로직:
- * 1. 현재 비디오 재생 시간 확인
- * 2. 현재 큐의 시작/종료 시간과 비교
- * 3. 자막 표시/숨김 처리
+ * 1. 현재 큐의 시작/종료 시간과 비교
+ * 2. 자막 표시/숨김 처리
  */
-void USubtitle::Tick(float DeltaTime)
+void USubtitle::UpdateCue(const FTimespan& CurrentTime)
 {
-	if (!VideoPlayer.IsValid())
+	if (!SubtitleCue.IsValidIndex(CurrentIndex))
 	{
 		return;
 	}
 
-	const FTimespan CurrentTime = VideoPlayer->GetTime();
-
 	if (bIsShowingNarration)
 	{
 		// 현재 자막의 종료 시간 체크
@@ -150,6 +162,7 @@ void USubtitle::Tick(float DeltaTime)
 			// 모든 자막 표시 완료
 			if (CurrentIndex >= SubtitleCue.Num())
 			{
+				UnbindMediaClockEvents();
 				VideoPlayer = nullptr;
 				CurrentIndex = 0;
 			}
@@ -174,14 +187,172 @@ void USubtitle::Tick(float DeltaTime)
 	}
 }
 
+/**
+ * 다음 큐 경계 예약
+ *
+ * 로직:
+ * 1. 표시 중이면 종료 시간, 아니면 시작 시간을 다음 경계로 선택
+ * 2. (경계 - 현재 시간) / 재생 속도 만큼 뒤에 한 번만 깨어나도록 예약
+ * 3. 일시정지/미오픈 상태면 재개 이벤트를 기다리며 저빈도로만 재확인
+ * 4. 클럭을 신뢰할 수 없으면 매 프레임 Tick 폴링으로 폴백
+ */
+void USubtitle::ScheduleNextBoundary()
+{
+	ClearSchedule();
+
+	if (!VideoPlayer.IsValid() || !SubtitleCue.IsValidIndex(CurrentIndex))
+	{
+		return;
+	}
+
+	if (!bUseScheduledTiming)
+	{
+		TimingMode = ESubtitleTimingMode::Polling;
+		return;
+	}
+
+	// 재생 전(오픈 대기) 또는 일시정지 : 재개 이벤트 누락 대비 저빈도 재확인
+	static constexpr float IdleRecheckInterval = 0.25f;
+	if (!VideoPlayer->IsPlaying())
+	{
+		TimingMode = ESubtitleTimingMode::Scheduled;
+		ScheduleHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &USubtitle::OnScheduledBoundary), IdleRecheckInterval);
+		return;
+	}
+
+	if (!IsMediaClockReliable())
+	{
+		// 로그 : [Subtitle] Media clock unreliable, fallback to tick polling
+		TimingMode = ESubtitleTimingMode::Polling;
+		return;
+	}
+
+	const FSubtitleCue& Cue = SubtitleCue[CurrentIndex];
+	const FTimespan Boundary = bIsShowingNarration ? Cue.EndTime : Cue.StartTime;
+	const FTimespan Remaining = Boundary - VideoPlayer->GetTime();
+	const float Delay = FMath::Max(0.f, static_cast<float>(Remaining.GetTotalSeconds() / VideoPlayer->GetRate()));
+
+	TimingMode = ESubtitleTimingMode::Scheduled;
+	ScheduleHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &USubtitle::OnScheduledBoundary), Delay);
+}
+
+void USubtitle::ClearSchedule()
+{
+	if (ScheduleHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ScheduleHandle);
+		ScheduleHandle.Reset();
+	}
+}
+
+/**
+ * 예약된 경계 시점 도달
+ * 클럭이 진행하지 않은 채 깨어나는 일이 반복되면 (버퍼링 등) 폴링으로 폴백
+ */
+bool USubtitle::OnScheduledBoundary(float DeltaTime)
+{
+	ScheduleHandle.Reset();
+
+	if (!VideoPlayer.IsValid())
+	{
+		return false;
+	}
+
+	const FTimespan CurrentTime = VideoPlayer->GetTime();
+	if (VideoPlayer->IsPlaying())
+	{
+		StalledWakeCount = CurrentTime > LastWakeTime ? 0 : StalledWakeCount + 1;
+	}
+	LastWakeTime = CurrentTime;
+
+	UpdateCue(CurrentTime);
+	ScheduleNextBoundary();
+
+	// 단발성 예약 (다음 경계는 새로 등록)
+	return false;
+}
+
+/**
+ * 미디어 클럭 신뢰 조건
+ * - 정방향 재생 속도
+ * - 연속 정체 횟수 미만
+ */
+bool USubtitle::IsMediaClockReliable() const
+{
+	if (!VideoPlayer.IsValid())
+	{
+		return false;
+	}
+
+	const float Rate = VideoPlayer->GetRate();
+	return FMath::IsFinite(Rate) && Rate > 0.f && StalledWakeCount < MaxStalledWakeCount;
+}
+
+void USubtitle::OnMediaClockChanged()
+{
+	// 재개/중단/탐색 후에는 정체 이력 초기화 후 경계 재계산
+	StalledWakeCount = 0;
+	LastWakeTime = VideoPlayer.IsValid() ? VideoPlayer->GetTime() : FTimespan(0);
+	ScheduleNextBoundary();
+}
+
+void USubtitle::BindMediaClockEvents(UMediaPlayer* Player)
+{
+	if (!Player)
+	{
+		return;
+	}
+
+	Player->OnPlaybackResumed.AddUniqueDynamic(this, &USubtitle::OnMediaClockChanged);
+	Player->OnPlaybackSuspended.AddUniqueDynamic(this, &USubtitle::OnMediaClockChanged);
+	Player->OnSeekCompleted.AddUniqueDynamic(this, &USubtitle::OnMediaClockChanged);
+}
+
+void USubtitle::UnbindMediaClockEvents()
+{
+	if (UMediaPlayer* Player = VideoPlayer.Get())
+	{
+		Player->OnPlaybackResumed.RemoveDynamic(this, &USubtitle::OnMediaClockChanged);
+		Player->OnPlaybackSuspended.RemoveDynamic(this, &USubtitle::OnMediaClockChanged);
+		Player->OnSeekCompleted.RemoveDynamic(this, &USubtitle::OnMediaClockChanged);
+	}
+}
+
+/**
+ * 폴링 모드 자막 동기화 (미디어 클럭 불안정 시에만 활성화)
+ *
+ * 로직:
+ * 1. 현재 비디오 재생 시간 확인
+ * 2. 자막 표시/숨김 처리
+ * 3. 클럭이 다시 진행하면 예약 모드로 복귀
+ */
+void USubtitle::Tick(float DeltaTime)
+{
+	if (!VideoPlayer.IsValid())
+	{
+		return;
+	}
+
+	const FTimespan CurrentTime = VideoPlayer->GetTime();
+	UpdateCue(CurrentTime);
+
+	if (bUseScheduledTiming && CurrentTime > LastWakeTime)
+	{
+		StalledWakeCount = 0;
+		LastWakeTime = CurrentTime;
+		ScheduleNextBoundary();
+	}
+}
+
 /**
  * Tick 활성화 조건
+ * - 폴링 모드이고
  * - VideoPlayer가 유효하고
  * - 아직 표시할 자막이 남아있을 때
  */
 bool USubtitle::IsTickable() const
 {
-	return VideoPlayer.IsValid() && CurrentIndex < SubtitleCue.Num();
+	return TimingMode == ESubtitleTimingMode::Polling && VideoPlayer.IsValid() && CurrentIndex < SubtitleCue.Num();
 }
 
 bool USubtitle::IsTickableInEditor() const
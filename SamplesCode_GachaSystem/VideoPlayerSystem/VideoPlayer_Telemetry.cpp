@@ -0,0 +1,356 @@
+/**
+ * Video Player - Telemetry Implementation
+ *
+ * 영상 전환 지연(첫 프레임까지의 시간, 영상 간 공백) 계측
+ * - Stat 카운터 : stat VideoPlayer
+ * - JSON 덤프  : VideoPlayer.DumpTelemetry 콘솔 명령 / DumpVideoTelemetry
+ */
+
+#include "VideoPlayer.h"
+#include "MediaPlayer.h"
+#include "Dom/JsonObject.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+DECLARE_STATS_GROUP(TEXT("VideoPlayer"), STATGROUP_VideoPlayer, STATCAT_Advanced);
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Videos Played"), STAT_Video_PlayCount, STATGROUP_VideoPlayer);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("False End Events"), STAT_Video_FalseEndCount, STATGROUP_VideoPlayer);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Early End Events"), STAT_Video_EarlyEndCount, STATGROUP_VideoPlayer);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Open Failures"), STAT_Video_OpenFailCount, STATGROUP_VideoPlayer);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Last Open (ms)"), STAT_Video_LastOpenMs, STATGROUP_VideoPlayer);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Last Time To First Frame (ms)"), STAT_Video_LastFirstFrameMs, STATGROUP_VideoPlayer);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Last Transition Gap (ms)"), STAT_Video_LastTransitionGapMs, STATGROUP_VideoPlayer);
+
+namespace VideoTelemetry
+{
+	const TCHAR* GetStageName(const EVideoLatencyStage InStage)
+	{
+		switch (InStage)
+		{
+		case EVideoLatencyStage::Open:				return TEXT("Open");
+		case EVideoLatencyStage::Decode:			return TEXT("Decode");
+		case EVideoLatencyStage::TimeToFirstFrame:	return TEXT("TimeToFirstFrame");
+		case EVideoLatencyStage::Playback:			return TEXT("Playback");
+		case EVideoLatencyStage::Dispatch:			return TEXT("Dispatch");
+		case EVideoLatencyStage::TransitionGap:		return TEXT("TransitionGap");
+		default:									return TEXT("Unknown");
+		}
+	}
+
+	static FAutoConsoleCommand DumpTelemetryCommand(
+		TEXT("VideoPlayer.DumpTelemetry"),
+		TEXT("Write video pipeline latency telemetry as JSON to Saved/Profiling."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			UVideoPlayer::DumpVideoTelemetry(true);
+		}));
+
+	static FAutoConsoleCommand ResetTelemetryCommand(
+		TEXT("VideoPlayer.ResetTelemetry"),
+		TEXT("Reset video pipeline latency telemetry."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			UVideoPlayer::ResetVideoTelemetry();
+		}));
+}
+
+#pragma region Histogram
+
+void FVideoLatencyHistogram::Add(const double InMs)
+{
+	const double Ms = FMath::Max(InMs, 0.0);
+
+	int32 Bucket = 0;
+	while (Bucket < NumBuckets - 1 && Ms >= GetBucketUpperBound(Bucket))
+	{
+		++Bucket;
+	}
+
+	++Buckets[Bucket];
+	++Count;
+	SumMs += Ms;
+	MaxMs = FMath::Max(MaxMs, Ms);
+}
+
+double FVideoLatencyHistogram::GetPercentile(const double InPercentile) const
+{
+	if (Count == 0)
+	{
+		return 0.0;
+	}
+
+	const uint32 Target = FMath::Max<uint32>(1, FMath::CeilToInt(Count * FMath::Clamp(InPercentile, 0.0, 1.0)));
+
+	uint32 Accumulated = 0;
+	for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+	{
+		Accumulated += Buckets[Bucket];
+		if (Accumulated >= Target)
+		{
+			return FMath::Min(GetBucketUpperBound(Bucket), MaxMs);
+		}
+	}
+	return MaxMs;
+}
+
+double FVideoLatencyHistogram::GetBucketUpperBound(const int32 InBucket)
+{
+	return InBucket >= NumBuckets - 1 ? TNumericLimits<double>::Max() : static_cast<double>(1 << InBucket);
+}
+
+#pragma endregion Histogram
+
+#pragma region Telemetry
+
+void FVideoPipelineTelemetry::OnPlayRequested(const FName& InGroupID)
+{
+	CurrentGroupID = InGroupID;
+	PlayRequestTime = FPlatformTime::Seconds();
+	OpenedTime = 0.0;
+	FirstFrameTime = 0.0;
+
+	++PlayCount;
+	INC_DWORD_STAT(STAT_Video_PlayCount);
+}
+
+void FVideoPipelineTelemetry::OnOpened()
+{
+	if (PlayRequestTime <= 0.0 || OpenedTime > 0.0)
+	{
+		return;
+	}
+
+	OpenedTime = FPlatformTime::Seconds();
+	Record(EVideoLatencyStage::Open, PlayRequestTime, OpenedTime);
+	SET_FLOAT_STAT(STAT_Video_LastOpenMs, (OpenedTime - PlayRequestTime) * 1000.0);
+}
+
+void FVideoPipelineTelemetry::OnFirstFrame()
+{
+	if (!IsWaitingFirstFrame())
+	{
+		return;
+	}
+
+	FirstFrameTime = FPlatformTime::Seconds();
+	Record(EVideoLatencyStage::Decode, OpenedTime, FirstFrameTime);
+	Record(EVideoLatencyStage::TimeToFirstFrame, PlayRequestTime, FirstFrameTime);
+	SET_FLOAT_STAT(STAT_Video_LastFirstFrameMs, (FirstFrameTime - PlayRequestTime) * 1000.0);
+
+	// 직전 영상 종료 후 화면 공백 (전환 구간은 종료된 영상 그룹 기준으로 기록)
+	if (PlaybackEndTime > 0.0)
+	{
+		const double GapMs = (FirstFrameTime - PlaybackEndTime) * 1000.0;
+		Groups.FindOrAdd(EndedGroupID).Stages[static_cast<int32>(EVideoLatencyStage::TransitionGap)].Add(GapMs);
+		SET_FLOAT_STAT(STAT_Video_LastTransitionGapMs, GapMs);
+		PlaybackEndTime = 0.0;
+	}
+}
+
+void FVideoPipelineTelemetry::OnPlaybackEnd()
+{
+	PlaybackEndTime = FPlatformTime::Seconds();
+	EndedGroupID = CurrentGroupID;
+
+	if (FirstFrameTime > 0.0)
+	{
+		Record(EVideoLatencyStage::Playback, FirstFrameTime, PlaybackEndTime);
+	}
+}
+
+void FVideoPipelineTelemetry::OnNextVideoRequested()
+{
+	if (PlaybackEndTime <= 0.0)
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	Groups.FindOrAdd(EndedGroupID).Stages[static_cast<int32>(EVideoLatencyStage::Dispatch)].Add((Now - PlaybackEndTime) * 1000.0);
+}
+
+void FVideoPipelineTelemetry::OnFalseEnd()
+{
+	++FalseEndCount;
+	INC_DWORD_STAT(STAT_Video_FalseEndCount);
+}
+
+void FVideoPipelineTelemetry::OnEarlyEnd()
+{
+	++EarlyEndCount;
+	INC_DWORD_STAT(STAT_Video_EarlyEndCount);
+}
+
+void FVideoPipelineTelemetry::OnOpenFailed()
+{
+	++OpenFailCount;
+	INC_DWORD_STAT(STAT_Video_OpenFailCount);
+
+	// 실패한 영상은 이후 구간 측정 제외
+	PlayRequestTime = 0.0;
+	OpenedTime = 0.0;
+	FirstFrameTime = 0.0;
+}
+
+void FVideoPipelineTelemetry::OnSequenceEnd()
+{
+	// 다음 재생 요청까지의 대기 시간이 전환 구간으로 기록되지 않도록 초기화
+	PlayRequestTime = 0.0;
+	OpenedTime = 0.0;
+	FirstFrameTime = 0.0;
+	PlaybackEndTime = 0.0;
+	EndedGroupID = NAME_None;
+}
+
+void FVideoPipelineTelemetry::Record(const EVideoLatencyStage InStage, const double InStartTime, const double InEndTime)
+{
+	Groups.FindOrAdd(CurrentGroupID).Stages[static_cast<int32>(InStage)].Add((InEndTime - InStartTime) * 1000.0);
+}
+
+void FVideoPipelineTelemetry::Reset()
+{
+	*this = FVideoPipelineTelemetry();
+}
+
+/**
+ * JSON 포맷
+ *
+ * {
+ *   "PlayCount": n, "FalseEndCount": n, "EarlyEndCount": n, "OpenFailCount": n,
+ *   "Groups": {
+ *     "<GroupID>": {
+ *       "<Stage>": { "Count", "MeanMs", "MaxMs", "P50Ms", "P90Ms", "P99Ms", "BucketUpperMs": [...], "Buckets": [...] }
+ *     }
+ *   }
+ * }
+ */
+FString FVideoPipelineTelemetry::ToJson() const
+{
+	const TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetNumberField(TEXT("PlayCount"), PlayCount);
+	Root->SetNumberField(TEXT("FalseEndCount"), FalseEndCount);
+	Root->SetNumberField(TEXT("EarlyEndCount"), EarlyEndCount);
+	Root->SetNumberField(TEXT("OpenFailCount"), OpenFailCount);
+
+	TArray<TSharedPtr<FJsonValue>> BucketBounds;
+	for (int32 Bucket = 0; Bucket < FVideoLatencyHistogram::NumBuckets - 1; ++Bucket)
+	{
+		BucketBounds.Emplace(MakeShared<FJsonValueNumber>(FVideoLatencyHistogram::GetBucketUpperBound(Bucket)));
+	}
+
+	const TSharedRef<FJsonObject> GroupsObject = MakeShared<FJsonObject>();
+	for (const TPair<FName, FGroupStats>& Pair : Groups)
+	{
+		const TSharedRef<FJsonObject> GroupObject = MakeShared<FJsonObject>();
+
+		for (int32 Stage = 0; Stage < static_cast<int32>(EVideoLatencyStage::Num); ++Stage)
+		{
+			const FVideoLatencyHistogram& Histogram = Pair.Value.Stages[Stage];
+			if (Histogram.Count == 0)
+			{
+				continue;
+			}
+
+			TArray<TSharedPtr<FJsonValue>> Buckets;
+			for (const uint32 BucketCount : Histogram.Buckets)
+			{
+				Buckets.Emplace(MakeShared<FJsonValueNumber>(BucketCount));
+			}
+
+			const TSharedRef<FJsonObject> StageObject = MakeShared<FJsonObject>();
+			StageObject->SetNumberField(TEXT("Count"), Histogram.Count);
+			StageObject->SetNumberField(TEXT("MeanMs"), Histogram.SumMs / Histogram.Count);
+			StageObject->SetNumberField(TEXT("MaxMs"), Histogram.MaxMs);
+			StageObject->SetNumberField(TEXT("P50Ms"), Histogram.GetPercentile(0.50));
+			StageObject->SetNumberField(TEXT("P90Ms"), Histogram.GetPercentile(0.90));
+			StageObject->SetNumberField(TEXT("P99Ms"), Histogram.GetPercentile(0.99));
+			StageObject->SetArrayField(TEXT("BucketUpperMs"), BucketBounds);
+			StageObject->SetArrayField(TEXT("Buckets"), Buckets);
+
+			GroupObject->SetObjectField(VideoTelemetry::GetStageName(static_cast<EVideoLatencyStage>(Stage)), StageObject);
+		}
+
+		GroupsObject->SetObjectField(Pair.Key.ToString(), GroupObject);
+	}
+	Root->SetObjectField(TEXT("Groups"), GroupsObject);
+
+	FString Output;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+	FJsonSerializer::Serialize(Root, Writer);
+	return Output;
+}
+
+#pragma endregion Telemetry
+
+#pragma region VideoPlayer
+
+FString UVideoPlayer::DumpVideoTelemetry(const bool bWriteToFile)
+{
+	if (!Instance)
+	{
+		return FString();
+	}
+
+	FString Json = Instance->Telemetry.ToJson();
+
+	if (bWriteToFile)
+	{
+		const FString FilePath = FPaths::ProfilingDir() / FString::Printf(TEXT("VideoTelemetry-%s.json"), *FDateTime::Now().ToString());
+		FFileHelper::SaveStringToFile(Json, *FilePath);
+		// 로그 : [VideoPlayer] Telemetry dumped to %s
+	}
+
+	return Json;
+}
+
+void UVideoPlayer::ResetVideoTelemetry()
+{
+	if (Instance)
+	{
+		Instance->Telemetry.Reset();
+	}
+}
+
+void UVideoPlayer::StartFirstFrameProbe()
+{
+	StopFirstFrameProbe();
+	FirstFrameProbeHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UVideoPlayer::OnFirstFrameProbe));
+}
+
+void UVideoPlayer::StopFirstFrameProbe()
+{
+	if (FirstFrameProbeHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(FirstFrameProbeHandle);
+		FirstFrameProbeHandle.Reset();
+	}
+}
+
+/**
+ * 첫 프레임 감지
+ * 미디어 클럭이 0을 넘어 진행하면 첫 프레임이 표시된 것으로 판단
+ */
+bool UVideoPlayer::OnFirstFrameProbe(float DeltaTime)
+{
+	if (!Telemetry.IsWaitingFirstFrame() || !MediaPlayer)
+	{
+		FirstFrameProbeHandle.Reset();
+		return false;
+	}
+
+	if (MediaPlayer->GetTime() > FTimespan::Zero())
+	{
+		Telemetry.OnFirstFrame();
+		FirstFrameProbeHandle.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+#pragma endregion VideoPlayer